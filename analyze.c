@@ -52,13 +52,36 @@ char *dup_chars(char *pathstrn, int begin, int end)
 
 	return (buffer);
 }
+/**
+ * join_path - Joins a PATH directory and a command name.
+ * @dir: The directory; an empty string stands for the current directory.
+ * @command: The command name.
+ *
+ * Return: A newly allocated "dir/command" string, or NULL on failure.
+ */
+char *join_path(char *dir, char *command)
+{
+	char *path;
+
+	if (!*dir)
+		return (dupStrn(command));
+	path = malloc(lenstrn(dir) + lenstrn(command) + 2);
+	if (!path)
+		return (NULL);
+	cpyStrn(path, dir);
+	catstrn(path, "/");
+	catstrn(path, command);
+	return (path);
+}
+
 /**
  * lookFor_path - Find the full path of a command in the PATH string.
  * @info: Pointer to the info struct.
  * @pathstrn: The PATH string to search for the command.
  * @command: The command to find.
  *
- * Return: string containing the full path of the command
+ * Return: string containing the full path of the command; it is newly
+ * allocated unless it is @command itself
  */
 char *lookFor_path(info_t *info, char *pathstrn, char *command)
 {
@@ -67,38 +90,23 @@ char *lookFor_path(info_t *info, char *pathstrn, char *command)
 	int curr_pos = 0;
 
 	if (!pathstrn)
-	return (NULL);
-	if ((lenstrn(command) > 2) && cmpstrn(command, "./", 2) == 0)
+		return (NULL);
+	if ((lenstrn(command) > 2) && starts_with_strn(command, "./"))
 	{
-	if (cmd_exists(info, command))
-	return (command);/* Duplicate and return the command. */
+		if (cmd_exists(info, command))
+			return (command);
 	}
-	for (a = 0; pathstrn[a] != '\0'; a++)
+	for (a = 0; ; a++)
 	{
-	if (pathstrn[a] == ':')
-		{
-	path = dup_chars(pathstrn + curr_pos, 0, a - curr_pos);
-	if (!*path)
-	strcat(path, command);
-	else
-	path = realloc(path, lenstrn(path) + lenstrn(command) + 2);
-	strcat(path, "/");
-	strcat(path, command);
-	if (cmd_exists(info, path))
-	return (path);
-	free(path);/* Free allocated memory for path. */
-	curr_pos = a + 1;/* Update the current position. */
-		}
+		if (pathstrn[a] && pathstrn[a] != ':')
+			continue;
+		path = join_path(dup_chars(pathstrn, curr_pos, a), command);
+		if (path && cmd_exists(info, path))
+			return (path);
+		free(path);/* Free allocated memory for path. */
+		if (!pathstrn[a])
+			break;
+		curr_pos = a + 1;/* Update the current position. */
 	}
-	path = dup_chars(pathstrn + curr_pos, 0, strlen(pathstrn) - curr_pos);
-	if (!*path)
-	path = strdup(command);
-	else
-	path = realloc(path, lenstrn(path) + lenstrn(command) + 2);
-	strcat(path, "/");
-	strcat(path, command);
-	if (cmd_exists(info, path))
-	return (path);
-	free(path);
 	return (NULL);
 }
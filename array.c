@@ -0,0 +1,162 @@
+#include "myshell.h"
+
+/**
+ * array_new - Allocates an empty array.
+ * @kind: ARRAY_DENSE for an indexed array or ARRAY_ASSOC for an
+ *        associative one.
+ *
+ * Return: The new array, or NULL if allocation fails.
+ */
+array_t *array_new(int kind)
+{
+	array_t *arr = malloc(sizeof(array_t));
+
+	if (!arr)
+		return (NULL);
+	memset(arr, 0, sizeof(array_t));
+	arr->kind = kind;
+	return (arr);
+}
+
+/**
+ * array_free - Frees an array and all of its elements.
+ * @arr: The array to free; may be NULL.
+ */
+void array_free(array_t *arr)
+{
+	size_t a;
+
+	if (!arr)
+		return;
+	for (a = 0; arr->vec && a < arr->len; a++)
+		free(arr->vec[a]);
+	for (a = 0; arr->ent && a < (arr->kind == ARRAY_ASSOC ? arr->cap : arr->len);
+			a++)
+	{
+		free(arr->ent[a].key);
+		free(arr->ent[a].val);
+	}
+	free(arr->vec);
+	free(arr->ent);
+	free(arr);
+}
+
+/**
+ * array_sparsify - Switches a dense indexed array to sorted index/value
+ *                  pairs.
+ * @arr: The dense array.
+ *
+ * This happens when an assignment would leave the vector mostly holes
+ * (e.g. a[1000000]=x), so memory stays proportional to the element count.
+ *
+ * Return: 0 on success, -1 if allocation fails (the array is unchanged).
+ */
+int array_sparsify(array_t *arr)
+{
+	arrentry_t *ent;
+	size_t a, n = 0;
+
+	ent = malloc(sizeof(arrentry_t) * (arr->count + 8));
+	if (!ent)
+		return (-1);
+	for (a = 0; a < arr->len; a++)
+		if (arr->vec[a])
+		{
+			ent[n].key = NULL;
+			ent[n].idx = a;
+			ent[n++].val = arr->vec[a];
+		}
+	free(arr->vec);
+	arr->vec = NULL;
+	arr->ent = ent;
+	arr->len = n;
+	arr->cap = arr->count + 8;
+	arr->kind = ARRAY_SPARSE;
+	return (0);
+}
+
+/**
+ * array_sparse_slot - Binary-searches the pairs of a sparse array.
+ * @arr: The sparse array.
+ * @idx: The index to find.
+ * @create: Non-zero to insert an empty pair when @idx is missing.
+ *
+ * Appending past the highest index never moves existing pairs.
+ *
+ * Return: The pair for @idx, or NULL if it is missing and not created.
+ */
+arrentry_t *array_sparse_slot(array_t *arr, long idx, int create)
+{
+	size_t lo = 0, hi = arr->len, mid;
+	arrentry_t *ent;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (arr->ent[mid].idx == idx)
+			return (&arr->ent[mid]);
+		if (arr->ent[mid].idx < idx)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (!create)
+		return (NULL);
+	if (arr->len == arr->cap)
+	{
+		ent = realloc(arr->ent, sizeof(arrentry_t) * arr->cap * 2);
+		if (!ent)
+			return (NULL);
+		arr->ent = ent;
+		arr->cap *= 2;
+	}
+	memmove(&arr->ent[lo + 1], &arr->ent[lo], sizeof(arrentry_t) * (arr->len - lo));
+	arr->ent[lo].key = arr->ent[lo].val = NULL;
+	arr->ent[lo].idx = idx;
+	arr->len++;
+	return (&arr->ent[lo]);
+}
+
+/**
+ * array_index_set - Stores a value at an index of an indexed array.
+ * @arr: The indexed array (dense or sparse).
+ * @idx: The non-negative index.
+ * @val: The value; ownership passes to the array.
+ *
+ * Return: 0 on success, -1 on failure (@val is freed).
+ */
+int array_index_set(array_t *arr, long idx, char *val)
+{
+	size_t cap;
+	char **vec;
+	arrentry_t *e;
+
+	if (arr->kind == ARRAY_DENSE && (size_t)idx >= arr->len &&
+			(size_t)idx > 2 * (arr->count + 16) && array_sparsify(arr))
+		return (free(val), -1);
+	if (arr->kind == ARRAY_SPARSE)
+	{
+		e = array_sparse_slot(arr, idx, 1);
+		if (!e)
+			return (free(val), -1);
+		arr->count += !e->val;
+		return (free(e->val), e->val = val, 0);
+	}
+	if ((size_t)idx >= arr->cap)
+	{
+		for (cap = arr->cap ? arr->cap * 2 : 8; cap <= (size_t)idx; cap *= 2)
+			;
+		vec = realloc(arr->vec, sizeof(char *) * cap);
+		if (!vec)
+			return (free(val), -1);
+		memset(vec + arr->cap, 0, sizeof(char *) * (cap - arr->cap));
+		arr->vec = vec;
+		arr->cap = cap;
+	}
+	arr->count += !arr->vec[idx];
+	free(arr->vec[idx]);
+	arr->vec[idx] = val;
+	if ((size_t)idx >= arr->len)
+		arr->len = idx + 1;
+	return (0);
+}
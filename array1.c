@@ -0,0 +1,166 @@
+#include "myshell.h"
+
+/**
+ * array_assoc_slot - Probes an associative array's open-addressing table.
+ * @arr: The associative array.
+ * @key: The key to find.
+ * @create: Non-zero to claim a free slot when @key is missing.
+ *
+ * Linear probing over a power-of-two table. A slot whose key is set but
+ * whose value is NULL is a tombstone left by unset; it is reused on insert.
+ *
+ * Return: The slot holding @key (or claimed for it), or NULL.
+ */
+arrentry_t *array_assoc_slot(array_t *arr, const char *key, int create)
+{
+	unsigned int hash = var_hash(key, strlen(key));
+	arrentry_t *e, *tomb = NULL;
+	size_t a, mask;
+
+	if (create && (arr->len + 1) * 4 >= arr->cap * 3 && array_assoc_grow(arr))
+		return (NULL);
+	if (!arr->cap)
+		return (NULL);
+	mask = arr->cap - 1;
+	for (a = hash & mask; ; a = (a + 1) & mask)
+	{
+		e = &arr->ent[a];
+		if (!e->key)
+			break;
+		if (!e->val && !tomb)
+			tomb = e;
+		else if (e->val && e->idx == (long)hash && !strcmp(e->key, key))
+			return (e);
+	}
+	if (!create)
+		return (NULL);
+	if (tomb)
+		e = tomb;
+	else
+		arr->len++;
+	free(e->key);
+	e->key = dupStrn(key);
+	e->idx = hash;
+	return (e->key ? e : NULL);
+}
+
+/**
+ * array_assoc_grow - Doubles an associative array's table, dropping
+ *                    tombstones.
+ * @arr: The associative array.
+ *
+ * Return: 0 on success, -1 if allocation fails.
+ */
+int array_assoc_grow(array_t *arr)
+{
+	arrentry_t *old = arr->ent, *e;
+	size_t a, b, oldcap = arr->cap, cap = arr->cap ? arr->cap * 2 : 16;
+
+	if (arr->count * 4 < oldcap)
+		cap = oldcap; /* mostly tombstones: rehash in place size */
+	arr->ent = malloc(sizeof(arrentry_t) * cap);
+	if (!arr->ent)
+		return (arr->ent = old, -1);
+	memset(arr->ent, 0, sizeof(arrentry_t) * cap);
+	arr->cap = cap;
+	arr->len = arr->count;
+	for (a = 0; a < oldcap; a++)
+	{
+		if (!old[a].val)
+		{
+			free(old[a].key);
+			continue;
+		}
+		for (b = old[a].idx & (cap - 1); arr->ent[b].key; b = (b + 1) & (cap - 1))
+			;
+		e = &arr->ent[b];
+		*e = old[a];
+	}
+	free(old);
+	return (0);
+}
+
+/**
+ * array_assoc_set - Stores a value under a key of an associative array.
+ * @arr: The associative array.
+ * @key: The key.
+ * @val: The value; ownership passes to the array.
+ *
+ * Return: 0 on success, -1 on failure (@val is freed).
+ */
+int array_assoc_set(array_t *arr, const char *key, char *val)
+{
+	arrentry_t *e = array_assoc_slot(arr, key, 1);
+
+	if (!e)
+		return (free(val), -1);
+	arr->count += !e->val;
+	free(e->val);
+	e->val = val;
+	return (0);
+}
+
+/**
+ * array_unset - Removes one element of an array.
+ * @arr: The array.
+ * @key: The key, or the already-resolved index for indexed arrays.
+ * @idx: The resolved index (ignored for associative arrays).
+ */
+void array_unset(array_t *arr, const char *key, long idx)
+{
+	arrentry_t *e;
+
+	if (arr->kind == ARRAY_ASSOC)
+		e = array_assoc_slot(arr, key, 0);
+	else if (arr->kind == ARRAY_SPARSE)
+		e = array_sparse_slot(arr, idx, 0);
+	else
+	{
+		if (idx < 0 || (size_t)idx >= arr->len || !arr->vec[idx])
+			return;
+		free(arr->vec[idx]);
+		arr->vec[idx] = NULL;
+		arr->count--;
+		return;
+	}
+	if (!e || !e->val)
+		return;
+	free(e->val);
+	e->val = NULL;
+	arr->count--;
+	if (arr->kind == ARRAY_SPARSE)
+	{
+		memmove(e, e + 1, sizeof(arrentry_t) * (arr->len - (e - arr->ent) - 1));
+		arr->len--;
+	}
+}
+
+/**
+ * array_get - Looks up one element of an array.
+ * @arr: The array.
+ * @key: The key for associative arrays.
+ * @idx: The resolved index for indexed arrays; negative counts from the
+ *       end.
+ *
+ * Return: The element's value (owned by the array), or NULL if unset.
+ */
+char *array_get(array_t *arr, const char *key, long idx)
+{
+	arrentry_t *e;
+
+	if (arr->kind == ARRAY_ASSOC)
+	{
+		e = array_assoc_slot(arr, key, 0);
+		return (e ? e->val : NULL);
+	}
+	if (idx < 0)
+		idx += array_end(arr);
+	if (idx < 0)
+		return (NULL);
+	if (arr->kind == ARRAY_SPARSE)
+	{
+		e = array_sparse_slot(arr, idx, 0);
+		return (e ? e->val : NULL);
+	}
+	return ((size_t)idx < arr->len ? arr->vec[idx] : NULL);
+}
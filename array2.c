@@ -0,0 +1,112 @@
+#include "myshell.h"
+
+/**
+ * array_end - Gets the index one past the highest set index.
+ * @arr: An indexed array.
+ *
+ * Return: The index that an append would use.
+ */
+long array_end(array_t *arr)
+{
+	if (arr->kind == ARRAY_SPARSE)
+		return (arr->len ? arr->ent[arr->len - 1].idx + 1 : 0);
+	return (arr->len);
+}
+
+/**
+ * array_set - Stores a value in an array.
+ * @arr: The array.
+ * @key: The key for associative arrays.
+ * @idx: The resolved index for indexed arrays; negative counts from the
+ *       end.
+ * @val: The value; ownership passes to the array.
+ *
+ * Return: 0 on success, -1 on failure or a bad index (@val is freed).
+ */
+int array_set(array_t *arr, const char *key, long idx, char *val)
+{
+	if (!val)
+		return (-1);
+	if (arr->kind == ARRAY_ASSOC)
+		return (array_assoc_set(arr, key, val));
+	if (idx < 0)
+		idx += array_end(arr);
+	if (idx < 0)
+		return (free(val), -1);
+	return (array_index_set(arr, idx, val));
+}
+
+/**
+ * array_append - Appends a value after the highest index of an array.
+ * @arr: An indexed array.
+ * @val: The value; ownership passes to the array.
+ *
+ * The dense vector doubles when full, so appends are amortized O(1).
+ *
+ * Return: 0 on success, -1 on failure (@val is freed).
+ */
+int array_append(array_t *arr, char *val)
+{
+	if (!val)
+		return (-1);
+	return (array_index_set(arr, array_end(arr), val));
+}
+
+/**
+ * array_list - Lists the values or the keys of an array in order.
+ * @arr: The array.
+ * @keys: Non-zero to list keys (indices for indexed arrays).
+ *
+ * Return: A newly allocated NULL-terminated vector of newly allocated
+ *         strings (free with free_strn()), or NULL on failure.
+ */
+char **array_list(array_t *arr, int keys)
+{
+	char **v = malloc(sizeof(char *) * (arr->count + 1));
+	size_t a, n = 0, end;
+	arrentry_t *e;
+
+	if (!v)
+		return (NULL);
+	end = arr->kind == ARRAY_ASSOC ? arr->cap : arr->len;
+	for (a = 0; a < end && n < arr->count; a++)
+	{
+		if (arr->kind == ARRAY_DENSE)
+		{
+			if (arr->vec[a])
+				v[n++] = dupStrn(keys ? number_to_strn(a, 10, 0) : arr->vec[a]);
+			continue;
+		}
+		e = &arr->ent[a];
+		if (!e->val)
+			continue;
+		if (!keys)
+			v[n++] = dupStrn(e->val);
+		else
+			v[n++] = dupStrn(e->key ? e->key : number_to_strn(e->idx, 10, 0));
+	}
+	v[n] = NULL;
+	return (v);
+}
+
+/**
+ * array_index - Resolves an indexed-array subscript to a number.
+ * @info: The parameter struct holding the shell variables.
+ * @sub: The (already expanded) subscript text.
+ *
+ * A bare variable name stands for its value, as in arithmetic context.
+ *
+ * Return: The index (0 for an empty or non-numeric subscript).
+ */
+long array_index(info_t *info, char *sub)
+{
+	size_t n = var_name_len(sub);
+	char *value;
+
+	if (n && !sub[n])
+	{
+		value = var_value(info, sub, n);
+		return (value ? strtol(value, NULL, 10) : 0);
+	}
+	return (strtol(sub, NULL, 10));
+}
@@ -0,0 +1,199 @@
+#include "myshell.h"
+
+/**
+ * array_var - Gets a variable as an array, converting or creating it.
+ * @info: The parameter struct holding the shell variables.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ * @kind: ARRAY_ASSOC to require an associative array, ARRAY_DENSE for an
+ *        indexed one (an existing associative array is kept as is).
+ * @local: Non-zero to use or create the name in the function scope.
+ *
+ * A scalar becomes an array whose element 0 is its old value.
+ *
+ * Return: The variable, or NULL on error (readonly, bad conversion, ENOMEM).
+ */
+var_t *array_var(info_t *info, const char *name, size_t len, int kind,
+		int local)
+{
+	var_t *v = local ? var_find(info->vars, name, len, var_hash(name, len)) :
+		var_lookup(info, name, len);
+	char *msg = "readonly variable";
+
+	if (!v)
+		v = local ? var_local(info, name, len, NULL, 0) :
+			var_set(info, name, len, NULL, 0);
+	if (!v)
+		return (NULL);
+	if (!(v->flags & VAR_READONLY) && v->array && (kind != ARRAY_ASSOC ||
+				v->array->kind == ARRAY_ASSOC))
+		return (v);
+	if (!(v->flags & VAR_READONLY) && !v->array)
+	{
+		v->array = array_new(kind);
+		if (!v->array)
+			return (NULL);
+		if (!(v->flags & VAR_NOVALUE))
+			array_set(v->array, "0", 0, dupStrn(v->pair + v->namelen + 1));
+		if (v->flags & VAR_EXPORT)
+			info->env_changed = 1; /* arrays are never exported */
+		v->flags |= VAR_NOVALUE;
+		return (v);
+	}
+	if (!(v->flags & VAR_READONLY))
+		msg = "cannot convert indexed to associative array";
+	fprintf(stderr, "%s: %d: %.*s: %s\n", info->fname, info->line_count,
+			(int)len, name, msg);
+	return (NULL);
+}
+
+/**
+ * assign_word - Performs one assignment word.
+ * @info: The parameter struct holding the shell variables.
+ * @word: A word accepted by assign_len(): NAME=value, NAME+=value,
+ *        NAME[sub]=value or NAME[sub]+=value, already expanded, or a
+ *        NAME=(...) or NAME+=(...) list as written.
+ * @local: Non-zero to assign in the function scope.
+ *
+ * Return: 0 on success, 1 on failure.
+ */
+int assign_word(info_t *info, char *word, int local)
+{
+	size_t n = var_name_len(word), alen = assign_len(word);
+	int append = alen > 1 && word[alen - 2] == '+';
+	char *val = word + alen;
+	int compound = assign_is_compound(word);
+	var_t *v;
+
+	if (!alen)
+		return (1);
+	if (word[n] == '[' || compound)
+	{
+		v = array_var(info, word, n, ARRAY_DENSE, local);
+		if (!v)
+			return (1);
+		if (word[n] == '[')
+			return (assign_element(info, v, word + n + 1, append));
+		return (assign_compound(info, v, val, append));
+	}
+	if (append)
+		return (assign_append(info, word, n, val, local));
+	if (local)
+		return (!var_local(info, word, n, val, 0));
+	return (!var_set(info, word, n, val, 0));
+}
+
+/**
+ * assign_compound - Assigns a (...) list to an array.
+ * @info: The parameter struct holding the shell variables.
+ * @v: The array variable.
+ * @val: The list as written, parentheses included, e.g. "(a "$b" [5]=c)".
+ * @append: Non-zero for +=, which keeps the current elements.
+ *
+ * Each element is expanded on its own, so "${other[@]}" copies an array
+ * element for element and quoted blanks stay inside an element.
+ *
+ * Return: 0 on success, 1 if any element failed.
+ */
+int assign_compound(info_t *info, var_t *v, char *val, int append)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	char *inner = dupStrn(val + 1), **items, *item;
+	int ret = 0, kind = v->array->kind == ARRAY_ASSOC ? ARRAY_ASSOC :
+		ARRAY_DENSE;
+	size_t a, b;
+
+	if (!inner)
+		return (1);
+	inner[strlen(inner) - 1] = '\0'; /* drop the closing parenthesis */
+	items = lex_words(inner);
+	free(inner);
+	if (!append)
+	{
+		array_free(v->array);
+		v->array = array_new(kind);
+		if (!v->array)
+			return (free_strn(items), 1);
+	}
+	for (a = 0; items && items[a]; a++)
+	{
+		if (items[a][0] == '[' && str_chr(items[a], ']'))
+		{
+			item = expand_string(info, items[a], strlen(items[a]));
+			val = item ? str_chr(item, ']') : NULL;
+			ret |= !val || assign_element(info, v, item + 1, val[1] == '+');
+			free(item);
+			continue;
+		}
+		wl.n = 0;
+		glob_fields(info, items[a], &wl);
+		for (b = 0; b < wl.n; b++) /* associative elements need a key */
+			ret |= kind == ARRAY_ASSOC ? (free(wl.v[b]), 1) :
+				array_append(v->array, wl.v[b]) ? 1 : 0;
+	}
+	free(wl.v);
+	free_strn(items);
+	return (ret);
+}
+
+/**
+ * assign_element - Assigns one element of an array.
+ * @info: The parameter struct holding the shell variables.
+ * @v: The array variable.
+ * @sub: The text after '[': "key]=value" or "key]+=value".
+ * @append: Non-zero to append to the element's current value.
+ *
+ * Return: 0 on success, 1 on failure.
+ */
+int assign_element(info_t *info, var_t *v, char *sub, int append)
+{
+	char *close = str_chr(sub, ']'), *key, *val, *old;
+	strbuf_t sb = {NULL, 0, 0};
+	long idx = 0;
+	int ret;
+
+	if (!close || close[1 + append] != '=')
+		return (1);
+	key = dupStrn(sub);
+	if (!key)
+		return (1);
+	key[close - sub] = '\0';
+	val = close + 2 + append;
+	if (v->array->kind != ARRAY_ASSOC)
+		idx = array_index(info, key);
+	old = append ? array_get(v->array, key, idx) : NULL;
+	if (old)
+		sb_add(&sb, old, strlen(old));
+	sb_add(&sb, val, strlen(val));
+	ret = array_set(v->array, key, idx, sb_take(&sb));
+	free(key);
+	return (ret ? 1 : 0);
+}
+
+/**
+ * assign_append - Performs NAME+=value on a scalar.
+ * @info: The parameter struct holding the shell variables.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ * @val: The text to append.
+ * @local: Non-zero to assign in the function scope.
+ *
+ * Return: 0 on success, 1 on failure.
+ */
+int assign_append(info_t *info, char *name, size_t len, char *val, int local)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	char *old = var_value(info, name, len), *joined;
+	var_t *v;
+
+	if (old)
+		sb_add(&sb, old, strlen(old));
+	sb_add(&sb, val, strlen(val));
+	joined = sb_take(&sb);
+	if (!joined)
+		return (1);
+	v = local ? var_local(info, name, len, joined, 0) :
+		var_set(info, name, len, joined, 0);
+	free(joined);
+	return (!v);
+}
@@ -0,0 +1,117 @@
+#include "myshell.h"
+
+/**
+ * var_name_len - Measures the variable name at the start of a string.
+ * @s: The string to scan.
+ *
+ * A name is a letter or underscore followed by letters, digits and
+ * underscores.
+ *
+ * Return: The length of the name, or 0 if @s does not start with one.
+ */
+size_t var_name_len(const char *s)
+{
+	size_t a = 0;
+
+	if (!s || (!check_alphabet(s[0]) && s[0] != '_'))
+		return (0);
+	for (a = 1; check_alphabet(s[a]) || s[a] == '_' ||
+			(s[a] >= '0' && s[a] <= '9'); a++)
+		;
+	return (a);
+}
+
+/**
+ * assign_len - Measures the assignment prefix of a word.
+ * @s: The word to scan.
+ *
+ * Accepts NAME=, NAME+=, NAME[sub]= and NAME[sub]+=.
+ *
+ * Return: The length up to and including the '=', or 0 if @s is not an
+ *         assignment word.
+ */
+size_t assign_len(const char *s)
+{
+	size_t n = var_name_len(s);
+	const char *p = s + n;
+
+	if (!n)
+		return (0);
+	if (*p == '[')
+	{
+		p = strchr(p, ']');
+		if (!p)
+			return (0);
+		p++;
+	}
+	if (*p == '+')
+		p++;
+	return (*p == '=' ? (size_t)(p - s) + 1 : 0);
+}
+
+/**
+ * split_assignments - Moves the assignment words leading a command out
+ *                     of 'argv' and into 'assignv'.
+ * @info: The parameter struct holding the split 'argv'.
+ *
+ * Afterwards argv[0] is the command name (or NULL for a pure assignment
+ * statement) and info->assigns holds the number of assignment words.
+ *
+ * Return: The number of leading assignment words.
+ */
+int split_assignments(info_t *info)
+{
+	int a, b;
+
+	for (a = 0; info->argv && info->argv[a] && assign_len(info->argv[a]); a++)
+		;
+	if (!a)
+		return (0);
+	info->assignv = malloc(sizeof(char *) * (a + 1));
+	if (!info->assignv)
+		return (0); /* leave them in argv, where they run as a command */
+	for (b = 0; b < a; b++)
+		info->assignv[b] = info->argv[b];
+	info->assignv[a] = NULL;
+	for (b = 0; info->argv[a + b]; b++)
+		info->argv[b] = info->argv[a + b];
+	info->argv[b] = NULL;
+	info->argc = b;
+	info->assigns = a;
+	return (a);
+}
+
+/**
+ * run_assignments - Performs the 'assignv' words as shell variable
+ *                   assignments.
+ * @info: The parameter struct holding the expanded 'assignv'.
+ *
+ * The variables keep their export attribute, so only names that were
+ * already exported reach the environment of later children.
+ *
+ * Return: 0 on success, 1 if any assignment failed.
+ */
+int run_assignments(info_t *info)
+{
+	int a, ret = 0;
+
+	for (a = 0; a < info->assigns; a++)
+		ret |= assign_word(info, info->assignv[a], 0);
+	return (ret);
+}
+
+/**
+ * assign_is_compound - Checks for a NAME=(...) array list assignment.
+ * @word: The word to check, as written.
+ *
+ * The elements of such a list are expanded one by one when it is
+ * assigned, so the word itself is left unexpanded.
+ *
+ * Return: 1 if @word assigns a (...) list, 0 otherwise.
+ */
+int assign_is_compound(const char *word)
+{
+	size_t n = assign_len(word), len = strlen(word);
+
+	return (n && word[n] == '(' && len > n + 1 && word[len - 1] == ')');
+}
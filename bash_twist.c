@@ -1,21 +1,20 @@
 #include "myshell.h"
 
 /**
- * search_builtin - Finds and executes a builtin command.
- * @info: Pointer to the parameter and return info struct.
+ * builtin_find - Finds a builtin command.
+ * @name: The command name.
  *
- * Return:
- * -1 if builtin not found,
- * 0 if builtin executed successfully,
- * 1 if builtin found but not successful,
- * -2 if builtin signals exit()
+ * The function returns 0 if the builtin executed successfully, 1 (or
+ * another status) if not, and -2 if it signals exit().
+ *
+ * Return: The function handling the builtin, or NULL if @name is not one.
  */
-int search_builtin(info_t *info)
+int (*builtin_find(char *name))(info_t *)
 {
-	int index, builtin_return = -1;
+	int index;
 
 	/* Define a table of built-in commands and their corresponding functions */
-	builtin_table builtintbl[] = {
+	static builtin_table builtintbl[] = {
 		{"cd", cd},
 		{"exit", exit_cmd},
 		{"help", chnge_dir},
@@ -24,6 +23,35 @@ int search_builtin(info_t *info)
 		{"env", env_cmd},
 		{"setenv", setenv_cmd},
 		{"unsetenv", unsetenv_cmd},
+		{"export", export_cmd},
+		{"readonly", readonly_cmd},
+		{"local", local_cmd},
+		{"unset", unset_cmd},
+		{"declare", declare_cmd},
+		{"typeset", declare_cmd},
+		{"mapfile", mapfile_cmd},
+		{"readarray", mapfile_cmd},
+		{"return", return_cmd},
+		{"source", source_cmd},
+		{".", source_cmd},
+		{"break", break_cmd},
+		{"continue", break_cmd},
+		{"batch", batch_cmd},
+		{"exec", exec_cmd},
+		{"coproc", coproc_cmd},
+		{"read", read_cmd},
+		{"getopts", getopts_cmd},
+		{"cat", cat_cmd},
+		{"cp", cp_cmd},
+		{"grep", grep_cmd},
+		{"wc", wc_cmd},
+		{"head", head_cmd},
+		{"tail", tail_cmd},
+		{"cut", cut_cmd},
+		{"sleep", sleep_cmd},
+		{"waitfor", waitfor_cmd},
+		{"timeout", timeout_cmd},
+		{"ulimit", ulimit_cmd},
 		{NULL, NULL}
 	};
 
@@ -32,16 +60,10 @@ int search_builtin(info_t *info)
 	{
 		size_t n = 8;
 
-		if (cmpstrn(info->argv[0], builtintbl[index].type, n) == 0)
-		{
-			info->line_count++;
-			builtin_return = builtintbl[index].func(info);
-			break;
-		}
+		if (cmpstrn(name, builtintbl[index].type, n) == 0)
+			return (builtintbl[index].func);
 	}
-
-	/* Return the result of the built-in command execution */
-	return (builtin_return);
+	return (NULL);
 }
 
 /**
@@ -49,16 +71,27 @@ int search_builtin(info_t *info)
  * @info: Pointer to the parameter and return info struct.
  * @av: Argument vector from main().
  *
+ * Each complete command (possibly spanning several lines) is parsed into
+ * a tree, compiled to bytecode and run; function definitions keep their
+ * compiled bodies.
+ *
  * Return:
  * 0 on success, 1 on error, or an error code.
  */
 int hash(info_t *info, char **av)
 {
-	int builtin_ret = 0;
-	ssize_t read_status = 0;
+	int read_status = 0;
+	node_t *tree;
+	prog_t *prog;
 
+	info->fname = av[0]; /* Set the program name from the argument vector */
+	if (info->script) /* compiled in advance; there is nothing to read */
+	{
+		vm_run(info, info->script);
+		read_status = -1;
+	}
 	/* Main shell loop */
-	for (; read_status != -1 && builtin_ret != -2; infoClear(info))
+	while (read_status != -1 && !(info->unwind & UNWIND_EXIT))
 	{
 		/* Print shell prompt if in interactive mode */
 		if (handleInteract(info))
@@ -67,32 +100,36 @@ int hash(info_t *info, char **av)
 		/* Flush the error buffer */
 		_errputchar(BUFFER_FLUSH);
 
-		/* Read user input */
-		read_status = inputGet(info);
+		/* Read and parse a complete command */
+		read_status = read_command(info, &tree);
 
-		if (read_status != -1)
+		prog = read_status == PARSE_OK ? compile_program(tree) : NULL;
+		node_free(tree);
+		if (prog)
+			vm_run(info, prog), prog_free(prog);
+		else if (read_status == PARSE_OK)
+			info->status = 1;
+		else if (read_status == PARSE_ERROR)
 		{
-			/* Set command-related information */
-			infoSet(info, av);
-			builtin_ret = search_builtin(info);
-			if (builtin_ret == -1)
-				find_command(info);
+			info->status = 2;
+			if (!handleInteract(info)) /* a broken script stops here */
+				break;
 		}
 		else if (handleInteract(info))
 			wrt_chr('\n');
-		infoFree(info, 0);
+		infoClear(info);
 	}
 	write_histFile(info);
 	infoFree(info, 1);
-	if (!handleInteract(info) && info->status)
-		exit(info->status);
-	if (builtin_ret == -2)
+	if (info->unwind & UNWIND_EXIT)
 	{
 		if (info->err_number == -1)
 			exit(info->status);
 		exit(info->err_number);
 	}
-	return (builtin_ret);
+	if (!handleInteract(info) && info->status)
+		exit(info->status);
+	return (0);
 }
 
 /**
@@ -100,21 +137,31 @@ int hash(info_t *info, char **av)
  *
  * @info: A pointer to the 'info' struct that stores all information.
  *
+ * A pipeline child (info->nofork) runs the command in place instead, and
+ * the command starts with the default SIGPIPE action even when a pipeline
+ * stage run by the shell was ignoring it. Under 'timeout' the wait is
+ * timeout_wait(), which signals the child once its time is up.
+ *
  * Return: Void (empty)
  */
 void forkExe_command(info_t *info)
 {
 	pid_t child_pid;
+	/* Build (or reuse) the cached envp in the parent, not per child */
+	char **envp = get_environ(info);
 
-	child_pid = fork();
+	child_pid = info->nofork ? 0 : fork();
 
 	switch (child_pid)
 	{
 		case -1:/* Error handling - Print an error message */
 			perror("Error:");
 			return;
-		case 0:/* Child process */
-			if (execve(info->path, info->argv, environ) == -1)
+		case 0:/* Child process, or a pipeline child running it in place */
+			signal(SIGPIPE, SIG_DFL);
+			if (info->assigns)/* VAR=value prefixes overlay the export list */
+				envp = overlay_envp(info, envp);
+			if (execve(info->path, info->argv, envp) == -1)
 			{
 				infoFree(info, 1);
 				switch (errno)
@@ -127,7 +174,10 @@ void forkExe_command(info_t *info)
 			}
 			break;
 		default:/* Parent process - Waits for the child to complete */
-			wait(&(info->status));
+			if (info->timeout)
+				timeout_wait(info, child_pid);
+			else
+				waitpid(child_pid, &(info->status), 0);
 			if (WIFEXITED(info->status))
 			{
 				info->status = WEXITSTATUS(info->status);
@@ -155,27 +205,18 @@ void forkExe_command(info_t *info)
 void find_command(info_t *info)
 {
 	char *path = NULL;
-	int i;
-	int k;
 
 	info->path = info->argv[0];
-	if (info->linecount_flag == 1)
-	{
-		info->line_count++;
-		info->linecount_flag = 0;
-	}
-	for (i = 0, k = 0; info->arg[i]; i++)
-	{
-		if (!check_delim(info->arg[i], " \t\n"))
-			k++;
-	}
-	if (!k)
+	if (!info->argv[0])
 		return;
 	path = lookFor_path(info, get_env(info, "PATH="), info->argv[0]);
 	if (path)
 	{
 		info->path = path;
 		forkExe_command(info);
+		if (path != info->argv[0])
+			free(path);
+		info->path = NULL;
 	}
 	else
 	{
@@ -185,7 +226,7 @@ void find_command(info_t *info)
 	{
 	forkExe_command(info);
 	}
-	else if (*(info->arg) != '\n')
+	else
 	{
 	info->status = 127;
 	printErro(info, "nonexistent\n");
@@ -0,0 +1,165 @@
+#include "myshell.h"
+
+/**
+ * batch_cmd - Runs a command as many times as its arguments need.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: batch [-j jobs] command [args...]
+ * The arguments are split into the largest batches the kernel accepts
+ * with the environment, and the command runs once per batch, up to
+ * 'jobs' at a time, like an xargs pipeline. Functions and builtins have
+ * no such limit and run once.
+ *
+ * Return: 0 if every run succeeded, 123 if one failed, 127 if the
+ *         command is not found, 2 on a usage error.
+ */
+int batch_cmd(info_t *info)
+{
+	char **argv = info->argv, *path, *end;
+	int a = 1, argc = info->argc, ret;
+	long jobs = 1;
+
+	if (argv[a] && !strncmp(argv[a], "-j", 2))
+	{
+		jobs = strtol(argv[a][2] ? argv[a] + 2 : argv[++a] ? argv[a] : "",
+				&end, 10);
+		if (*end || jobs < 1 || jobs > INT_MAX)
+			jobs = 0;
+		a++;
+	}
+	if (!jobs || !argv[a - 1] || !argv[a])
+	{
+		fprintf(stderr, "%s: %d: %s: usage: batch [-j jobs] command [args...]\n",
+				info->fname, info->line_count, argv[0]);
+		return (2);
+	}
+	if (func_find(info, argv[a]) || builtin_find(argv[a]))
+	{
+		info->argv = argv + a, info->argc = argc - a;
+		exec_command(info, NULL);
+		info->argv = argv, info->argc = argc;
+		return (info->status);
+	}
+	path = batch_find(info, argv[a]);
+	if (!path)
+		return (127);
+	ret = batch_run(info, path, argv + a, jobs);
+	if (path != argv[a])
+		free(path);
+	return (ret);
+}
+
+/**
+ * batch_find - Finds the program a batch runs.
+ * @info: The parameter struct holding the PATH.
+ * @name: The command name.
+ *
+ * Return: Its path, newly allocated unless it is @name itself, or NULL
+ *         after reporting that it does not exist.
+ */
+char *batch_find(info_t *info, char *name)
+{
+	char *path = lookFor_path(info, get_env(info, "PATH="), name);
+
+	if (!path && str_chr(name, '/') && cmd_exists(info, name))
+		path = name;
+	if (!path)
+		fprintf(stderr, "%s: %d: %s: nonexistent\n",
+				info->fname, info->line_count, name);
+	return (path);
+}
+
+/**
+ * batch_room - Works out how many bytes of arguments fit in one run.
+ * @info: The parameter struct holding the prefix assignments.
+ * @envp: The environment the program gets.
+ * @name: The command name, repeated in every run.
+ *
+ * Each string costs its bytes, its NUL and its pointer; 2048 bytes are
+ * left spare, as xargs does.
+ *
+ * Return: The room left for the batched arguments.
+ */
+size_t batch_room(info_t *info, char **envp, char *name)
+{
+	long max = sysconf(_SC_ARG_MAX);
+	size_t used = 2048 + strlen(name) + 1 + 2 * sizeof(char *);
+	int a;
+
+	if (max <= 0)
+		max = _POSIX_ARG_MAX;
+	for (a = 0; envp && envp[a]; a++)
+		used += strlen(envp[a]) + 1 + sizeof(char *);
+	for (a = 0; a < info->assigns; a++)
+		used += strlen(info->assignv[a]) + 1 + sizeof(char *);
+	return (used < (size_t)max ? max - used : 0);
+}
+
+/**
+ * batch_run - Runs a program over its arguments in batches.
+ * @info: The parameter struct.
+ * @path: The program.
+ * @cmd: The command name followed by the arguments.
+ * @jobs: The most runs going at once.
+ *
+ * A batch holds at least one argument, so one too large for the kernel
+ * still fails the way it would on its own.
+ *
+ * Return: 0 if every run succeeded, 123 otherwise.
+ */
+int batch_run(info_t *info, char *path, char **cmd, int jobs)
+{
+	char **envp = get_environ(info), **v;
+	size_t a = 1, b, n, used, room = batch_room(info, envp, cmd[0]);
+	pid_t *pids = malloc(sizeof(pid_t) * jobs);
+	int spawned = 0, waited = 0, failed = 0;
+
+	for (n = 0; cmd[n]; n++)
+		;
+	v = malloc(sizeof(char *) * (n + 1));
+	if (!v || !pids)
+		return (free(v), free(pids), 1);
+	v[0] = cmd[0];
+	do {
+		for (b = 1, used = 0; cmd[a] && (b == 1 ||
+					used + strlen(cmd[a]) + 1 + sizeof(char *) <= room); a++)
+			used += strlen(cmd[a]) + 1 + sizeof(char *), v[b++] = cmd[a];
+		v[b] = NULL;
+		if (spawned - waited == jobs)
+			failed |= batch_wait(pids[waited++ % jobs]);
+		pids[spawned % jobs] = batch_spawn(info, path, v, envp);
+		if (pids[spawned % jobs] == -1)
+			failed = 1;
+		else
+			spawned++;
+	} while (cmd[a]);
+	while (waited < spawned)
+		failed |= batch_wait(pids[waited++ % jobs]);
+	free(pids);
+	free(v);
+	return (failed ? 123 : 0);
+}
+
+/**
+ * batch_spawn - Starts one run of a batch.
+ * @info: The parameter struct holding the prefix assignments.
+ * @path: The program.
+ * @argv: The command name and this batch's arguments.
+ * @envp: The shell's exported envp from get_environ().
+ *
+ * Return: The child's process ID, or -1 if fork() fails.
+ */
+pid_t batch_spawn(info_t *info, char *path, char **argv, char **envp)
+{
+	pid_t pid = fork();
+
+	if (pid == -1)
+		perror("Error:");
+	if (pid)
+		return (pid);
+	if (info->assigns)
+		envp = overlay_envp(info, envp);
+	execve(path, argv, envp);
+	perror(argv[0]);
+	exit(errno == EACCES ? 126 : 1);
+}
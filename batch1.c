@@ -0,0 +1,16 @@
+#include "myshell.h"
+
+/**
+ * batch_wait - Waits for one run of a batch.
+ * @pid: The run's process ID.
+ *
+ * Return: 0 if it exited with status 0, 1 otherwise.
+ */
+int batch_wait(pid_t pid)
+{
+	int status;
+
+	if (waitpid(pid, &status, 0) == -1)
+		return (1);
+	return (!WIFEXITED(status) || WEXITSTATUS(status));
+}
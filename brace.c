@@ -0,0 +1,192 @@
+#include "myshell.h"
+#include <ctype.h>
+
+/**
+ * brace_parse - Splits a raw word into text and brace expansions.
+ * @s: The word, quotes included.
+ * @len: The length of @s.
+ * @groups: Incremented for every {a,b} or {x..y} found; set to -1 if
+ *          allocation fails.
+ *
+ * Braces inside quotes, after a backslash or in ${...} are left alone,
+ * as is any {...} that is neither a list nor a sequence.
+ *
+ * Return: The parts of the word, NULL if it is empty or on failure.
+ */
+brace_t *brace_parse(const char *s, size_t len, int *groups)
+{
+	brace_t *head = NULL, **tail = &head, *p;
+	size_t a = 0, lit = 0, end, n;
+	int comma;
+
+	while (a < len && *groups >= 0)
+	{
+		n = brace_skip(s + a, len - a);
+		if (!n && s[a] == '{' && (end = brace_close(s + a, len - a, &comma)))
+		{
+			p = comma ? brace_list(s + a + 1, end - 1, groups) :
+				brace_seq(s + a + 1, end - 1);
+			if (p)
+			{
+				(*groups)++;
+				tail = brace_text(tail, s + lit, a - lit, groups);
+				*tail = p;
+				tail = &p->next;
+				a += end + 1, lit = a;
+				continue;
+			}
+		}
+		a += n ? n : 1;
+	}
+	brace_text(tail, s + lit, len - lit, groups);
+	if (*groups < 0)
+		return (brace_free(head), NULL);
+	brace_stride(head);
+	return (head);
+}
+
+/**
+ * brace_close - Finds the '}' closing a brace.
+ * @s: The word at the '{'.
+ * @len: The number of bytes left in the word.
+ * @comma: Set if a comma separates alternatives at the top level.
+ *
+ * Return: The offset of the '}', or 0 if the brace is not closed.
+ */
+size_t brace_close(const char *s, size_t len, int *comma)
+{
+	size_t a = 1, n;
+	int depth = 1;
+
+	*comma = 0;
+	while (a < len)
+	{
+		n = brace_skip(s + a, len - a);
+		if (n)
+		{
+			a += n;
+			continue;
+		}
+		if (s[a] == '{')
+			depth++;
+		else if (s[a] == '}' && !--depth)
+			return (a);
+		else if (s[a] == ',' && depth == 1)
+			*comma = 1;
+		a++;
+	}
+	return (0);
+}
+
+/**
+ * brace_list - Parses the alternatives of a {a,b,...} expansion.
+ * @s: The text between the braces.
+ * @len: The length of @s.
+ * @groups: As for brace_parse(); nested expansions count too.
+ *
+ * Return: The BRACE_LIST part, or NULL if allocation fails.
+ */
+brace_t *brace_list(const char *s, size_t len, int *groups)
+{
+	brace_t *p = malloc(sizeof(brace_t)), **alts;
+	size_t a = 0, start = 0, n;
+	unsigned long total;
+	int depth = 0;
+
+	if (!p)
+		return (*groups = -1, NULL);
+	memset(p, 0, sizeof(brace_t));
+	p->kind = BRACE_LIST;
+	while (a <= len && *groups >= 0)
+	{
+		n = a < len ? brace_skip(s + a, len - a) : 0;
+		if (n || (a < len && (s[a] != ',' || depth)))
+		{
+			depth += n ? 0 : (s[a] == '{') - (s[a] == '}');
+			a += n ? n : 1;
+			continue;
+		}
+		alts = realloc(p->alts, sizeof(brace_t *) * (p->nalts + 1));
+		if (!alts)
+			break;
+		p->alts = alts;
+		alts[p->nalts] = brace_parse(s + start, a - start, groups);
+		total = brace_total(alts[p->nalts++]);
+		p->count = p->count + total < total ? ULONG_MAX : p->count + total;
+		start = ++a;
+	}
+	if (a <= len || *groups < 0)
+		return (*groups = -1, brace_free(p), NULL);
+	return (p);
+}
+
+/**
+ * brace_seq - Parses a {x..y} or {x..y..step} sequence expansion.
+ * @s: The text between the braces.
+ * @len: The length of @s.
+ *
+ * The ends are integers or single letters. Integers are zero-padded to
+ * the wider end when either is written with a leading zero.
+ *
+ * Return: The BRACE_SEQ part, or NULL if @s is not a sequence or
+ *         allocation fails.
+ */
+brace_t *brace_seq(const char *s, size_t len)
+{
+	char buf[96], *f[3], *dot;
+	long v[3] = {0, 0, 1};
+	unsigned long diff;
+	int n, alpha;
+	brace_t *p;
+
+	if (len >= sizeof(buf))
+		return (NULL);
+	memcpy(buf, s, len);
+	buf[len] = '\0';
+	for (n = 1, f[0] = buf; n < 3 && (dot = strstr(f[n - 1], "..")); n++)
+		*dot = '\0', f[n] = dot + 2;
+	if (n < 2 || strstr(f[n - 1], ".."))
+		return (NULL);
+	alpha = !f[0][1] && !f[1][1] && isalpha((unsigned char)*f[0]) &&
+		isalpha((unsigned char)*f[1]);
+	if (alpha)
+		v[0] = *f[0], v[1] = *f[1];
+	else if (!brace_num(f[0], &v[0]) || !brace_num(f[1], &v[1]))
+		return (NULL);
+	if (n == 3 && (!brace_num(f[2], &v[2]) || v[2] == LONG_MIN))
+		return (NULL);
+	p = malloc(sizeof(brace_t));
+	if (!p)
+		return (NULL);
+	memset(p, 0, sizeof(brace_t));
+	p->kind = BRACE_SEQ, p->alpha = alpha, p->lo = v[0];
+	p->step = v[2] < 0 ? -v[2] : v[2] ? v[2] : 1;
+	diff = v[0] <= v[1] ? (unsigned long)v[1] - (unsigned long)v[0] :
+		(unsigned long)v[0] - (unsigned long)v[1];
+	p->count = diff / p->step;
+	p->count += p->count < ULONG_MAX;
+	if (v[0] > v[1])
+		p->step = -p->step;
+	for (n = 0; !alpha && n < 2; n++)
+		if (f[n][*f[n] == '-'] == '0' && f[n][(*f[n] == '-') + 1])
+			p->width = strlen(f[strlen(f[0]) < strlen(f[1])]);
+	return (p);
+}
+
+/**
+ * brace_num - Parses an integer of a sequence expansion.
+ * @s: The text, an optional '-' and digits.
+ * @v: Receives the value.
+ *
+ * Return: 1 on success, 0 if @s is not an integer that fits in a long.
+ */
+int brace_num(const char *s, long *v)
+{
+	char *end;
+
+	if (!isdigit((unsigned char)s[*s == '-']))
+		return (0);
+	errno = 0;
+	*v = strtol(s, &end, 10);
+	return (!*end && errno != ERANGE);
+}
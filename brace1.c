@@ -0,0 +1,111 @@
+#include "myshell.h"
+
+/**
+ * brace_stride - Works out the stride of every part of a word.
+ * @b: The parts of the word.
+ *
+ * Return: The number of words @b makes, ULONG_MAX if that many or more.
+ */
+unsigned long brace_stride(brace_t *b)
+{
+	if (!b)
+		return (1);
+	b->stride = brace_stride(b->next);
+	return (brace_total(b));
+}
+
+/**
+ * brace_total - Counts the words a list of parts makes.
+ * @b: The parts, with their strides worked out.
+ *
+ * Return: The number of words, ULONG_MAX if that many or more.
+ */
+unsigned long brace_total(brace_t *b)
+{
+	if (!b)
+		return (1);
+	if (b->stride > ULONG_MAX / b->count)
+		return (ULONG_MAX);
+	return (b->count * b->stride);
+}
+
+/**
+ * brace_nth - Builds one word of a brace expansion.
+ * @b: The parts of the word.
+ * @i: The index of the word, below brace_total(@b); the last part varies
+ *     fastest, so the words come in the order they are written.
+ * @sb: The word is appended to it.
+ *
+ * Any word can be made without the ones before it, so a loop over
+ * {1..1000000} keeps a single word at a time.
+ */
+void brace_nth(brace_t *b, unsigned long i, strbuf_t *sb)
+{
+	unsigned long k, total;
+	char num[32];
+	size_t a;
+
+	for (; b; b = b->next)
+	{
+		k = i / b->stride % b->count;
+		if (b->kind == BRACE_TEXT)
+			sb_add(sb, b->text, strlen(b->text));
+		else if (b->kind == BRACE_SEQ && b->alpha)
+			sb_addc(sb, (char)(b->lo + (long)k * b->step));
+		else if (b->kind == BRACE_SEQ)
+			sb_add(sb, num, sprintf(num, "%0*ld", b->width,
+				(long)((unsigned long)b->lo + k * (unsigned long)b->step)));
+		for (a = 0; b->kind == BRACE_LIST && a < b->nalts; a++, k -= total)
+		{
+			total = brace_total(b->alts[a]);
+			if (k < total)
+			{
+				brace_nth(b->alts[a], k, sb);
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * brace_lazy - Parses a for loop word whose words can be made one by one.
+ * @word: The raw word.
+ *
+ * That is a word with brace expansions and nothing else to expand: no
+ * quotes, parameters, tildes or pattern characters.
+ *
+ * Return: The parts of the word, or NULL if it must be expanded at once.
+ */
+brace_t *brace_lazy(const char *word)
+{
+	brace_t *b;
+	int groups = 0;
+
+	if (!strchr(word, '{') || word[strcspn(word, "$'\"\\`~*?[")])
+		return (NULL);
+	b = brace_parse(word, strlen(word), &groups);
+	if (groups > 0 && brace_total(b) < ULONG_MAX)
+		return (b);
+	brace_free(b);
+	return (NULL);
+}
+
+/**
+ * brace_free - Frees the parts of a word.
+ * @b: The parts; may be NULL.
+ */
+void brace_free(brace_t *b)
+{
+	brace_t *next;
+	size_t a;
+
+	for (; b; b = next)
+	{
+		next = b->next;
+		for (a = 0; a < b->nalts; a++)
+			brace_free(b->alts[a]);
+		free(b->alts);
+		free(b->text);
+		free(b);
+	}
+}
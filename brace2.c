@@ -0,0 +1,67 @@
+#include "myshell.h"
+
+/**
+ * brace_skip - Measures a part of a word that braces inside do not split.
+ * @s: The word at the part.
+ * @len: The number of bytes left in the word.
+ *
+ * Return: The length of a quoted string, an escaped character or a
+ *         ${...} reference at @s, or 0 if there is none there.
+ */
+size_t brace_skip(const char *s, size_t len)
+{
+	size_t a = 1;
+	int depth = 1;
+
+	if (*s == '\\')
+		return (len > 1 ? 2 : 1);
+	if (*s == '\'')
+	{
+		while (a < len && s[a] != '\'')
+			a++;
+		return (a + (a < len));
+	}
+	if (*s == '"')
+	{
+		while (a < len && s[a] != '"')
+			a += s[a] == '\\' && a + 1 < len ? 2 : 1;
+		return (a + (a < len));
+	}
+	if (*s != '$' || len < 2 || s[1] != '{')
+		return (0);
+	for (a = 2; a < len && depth; a++)
+		depth += (s[a] == '{') - (s[a] == '}');
+	return (a);
+}
+
+/**
+ * brace_text - Adds a text part to a word.
+ * @tail: Where the part is linked.
+ * @s: The text.
+ * @len: The length of @s; nothing is added if it is 0.
+ * @groups: Set to -1 if allocation fails.
+ *
+ * Return: Where the next part is linked.
+ */
+brace_t **brace_text(brace_t **tail, const char *s, size_t len, int *groups)
+{
+	brace_t *p;
+
+	if (!len)
+		return (tail);
+	p = malloc(sizeof(brace_t));
+	if (p)
+		memset(p, 0, sizeof(brace_t)), p->text = malloc(len + 1);
+	if (!p || !p->text)
+	{
+		free(p);
+		*groups = -1;
+		return (tail);
+	}
+	memcpy(p->text, s, len);
+	p->text[len] = '\0';
+	p->kind = BRACE_TEXT;
+	p->count = 1;
+	*tail = p;
+	return (&p->next);
+}
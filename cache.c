@@ -0,0 +1,196 @@
+#include "myshell.h"
+
+/**
+ * script_cache - Compiles a script file as a whole, using the cache.
+ * @info: The parameter struct holding the shell variables.
+ * @fd: The open script file.
+ *
+ * The compiled form is kept under $XDG_CACHE_HOME/hsh (or ~/.cache/hsh),
+ * named after the script's device and inode and checked against its
+ * size, modification time and a hash of its contents; an unchanged
+ * script is loaded from there instead of being parsed again. Setting
+ * HSH_NOCACHE disables this, and HSH_CACHE_HITS and HSH_CACHE_MISSES
+ * count how often the cache was used.
+ *
+ * Return: The program, or NULL if the script should be read line by line
+ *         instead (caching disabled, not a regular file, or a syntax
+ *         error, which is then reported when the line is reached).
+ */
+prog_t *script_cache(info_t *info, int fd)
+{
+	struct stat st;
+	cachehdr_t hdr;
+	char *map, *path, *off = var_value(info, "HSH_NOCACHE", 11);
+	prog_t *prog;
+
+	if ((off && *off) || fstat(fd, &st) || !S_ISREG(st.st_mode) ||
+			!st.st_size)
+		return (NULL);
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		return (NULL);
+	memset(&hdr, 0, sizeof(hdr)); /* the padding is compared too */
+	memcpy(hdr.magic, CACHE_MAGIC, sizeof(hdr.magic));
+	hdr.dev = st.st_dev;
+	hdr.ino = st.st_ino;
+	hdr.size = st.st_size;
+	hdr.mtime = st.st_mtim.tv_sec;
+	hdr.mtime_ns = st.st_mtim.tv_nsec;
+	hdr.hash = var_hash(map, st.st_size);
+	path = cache_path(info, &st);
+	prog = path ? cache_load(path, &hdr) : NULL;
+	cache_count(info, prog != NULL);
+	if (!prog)
+	{
+		prog = script_compile(info, map, st.st_size);
+		if (prog && path)
+			cache_store(path, &hdr, prog);
+	}
+	munmap(map, st.st_size);
+	free(path);
+	return (prog);
+}
+
+/**
+ * script_compile - Parses and compiles a whole script.
+ * @info: The parameter struct; with info->fname unset no syntax error is
+ *        reported.
+ * @text: The script; it need not be NUL-terminated.
+ * @len: The length of @text.
+ *
+ * Return: The program, or NULL on a syntax error or a NUL byte.
+ */
+prog_t *script_compile(info_t *info, const char *text, size_t len)
+{
+	char *buf;
+	node_t *tree;
+	prog_t *prog = NULL;
+
+	if (memchr(text, '\0', len))
+		return (NULL);
+	buf = malloc(len + 2);
+	if (!buf)
+		return (NULL);
+	memcpy(buf, text, len);
+	if (len && buf[len - 1] != '\n')
+		buf[len++] = '\n';
+	buf[len] = '\0';
+	if (parse_program(info, buf, 1, &tree) == PARSE_OK)
+		prog = compile_program(tree);
+	node_free(tree);
+	free(buf);
+	return (prog);
+}
+
+/**
+ * cache_path - Builds the cache file name of a script.
+ * @info: The parameter struct holding the shell variables.
+ * @st: The status of the script.
+ *
+ * The cache directory is created if needed.
+ *
+ * Return: The allocated file name, or NULL if there is no cache directory.
+ */
+char *cache_path(info_t *info, struct stat *st)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	char *dir = var_value(info, "XDG_CACHE_HOME", 14);
+
+	if (dir && *dir)
+		sb_add(&sb, dir, strlen(dir));
+	else
+	{
+		dir = var_value(info, "HOME", 4);
+		if (!dir || !*dir)
+			return (NULL);
+		sb_add(&sb, dir, strlen(dir));
+		sb_add(&sb, "/.cache", 7);
+		if (sb.s)
+			mkdir(sb.s, 0700);
+	}
+	sb_add(&sb, "/hsh", 4);
+	if (!sb.s || (mkdir(sb.s, 0700) && errno != EEXIST))
+	{
+		free(sb.s);
+		return (NULL);
+	}
+	dir = number_to_strn(st->st_dev, 16,
+			CONVERTING_LOWERCASE | CONVERTING_UNSIGNED);
+	sb_addc(&sb, '/');
+	sb_add(&sb, dir, strlen(dir));
+	dir = number_to_strn(st->st_ino, 16,
+			CONVERTING_LOWERCASE | CONVERTING_UNSIGNED);
+	sb_addc(&sb, '-');
+	sb_add(&sb, dir, strlen(dir));
+	return (sb_take(&sb));
+}
+
+/**
+ * cache_load - Loads a compiled script from the cache.
+ * @path: The cache file.
+ * @hdr: The header the file must start with to match the script.
+ *
+ * Return: The program, or NULL if the file is missing, stale or damaged.
+ */
+prog_t *cache_load(char *path, cachehdr_t *hdr)
+{
+	int fd = open(path, O_RDONLY);
+	struct stat st;
+	cachereader_t rd;
+	char *map;
+	prog_t *prog = NULL;
+
+	if (fd == -1)
+		return (NULL);
+	if (!fstat(fd, &st) && st.st_size > (off_t)sizeof(*hdr))
+	{
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map != MAP_FAILED && !memcmp(map, hdr, sizeof(*hdr)))
+		{
+			rd.p = map + sizeof(*hdr);
+			rd.end = map + st.st_size;
+			prog = prog_load(&rd);
+			if (prog && rd.p != rd.end)
+				prog_free(prog), prog = NULL;
+		}
+		if (map != MAP_FAILED)
+			munmap(map, st.st_size);
+	}
+	close(fd);
+	return (prog);
+}
+
+/**
+ * cache_store - Writes a compiled script to the cache.
+ * @path: The cache file.
+ * @hdr: The header identifying the script.
+ * @prog: The program.
+ *
+ * The file is written under a temporary name and renamed into place, so
+ * shells running the same script at once never read half a file.
+ */
+void cache_store(char *path, cachehdr_t *hdr, prog_t *prog)
+{
+	strbuf_t sb = {NULL, 0, 0}, tmp = {NULL, 0, 0};
+	char *pid = number_to_strn(getpid(), 10, 0);
+	ssize_t w = 0;
+	size_t done;
+	int fd;
+
+	if (sb_add(&sb, (char *)hdr, sizeof(*hdr)) || prog_save(&sb, prog) ||
+			sb_add(&tmp, path, strlen(path)) || sb_addc(&tmp, '.') ||
+			sb_add(&tmp, pid, strlen(pid)))
+	{
+		free(sb.s), free(tmp.s);
+		return;
+	}
+	fd = open(tmp.s, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	for (done = 0; fd != -1 && done < sb.len && w >= 0; done += w)
+		w = write(fd, sb.s + done, sb.len - done);
+	if (fd != -1)
+		close(fd);
+	if (fd == -1 || w < 0 || rename(tmp.s, path))
+		unlink(tmp.s);
+	free(sb.s);
+	free(tmp.s);
+}
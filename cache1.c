@@ -0,0 +1,141 @@
+#include "myshell.h"
+
+/**
+ * prog_save - Serializes a program for the cache.
+ * @sb: Receives the bytes.
+ * @p: The program.
+ *
+ * Counts and instructions are stored as they are in memory; each command
+ * follows as its line, word count, the index of its name among the words,
+ * whether it has a function body and its redirection count, then the
+ * NUL-terminated words and redirections and the body itself. The cache is never shared between machines.
+ *
+ * Return: 0 on success, -1 if allocation fails.
+ */
+int prog_save(strbuf_t *sb, prog_t *p)
+{
+	int a, n, head[5], err;
+	cmd_t *c;
+
+	head[0] = p->len, head[1] = p->ncmds, head[2] = p->loops;
+	err = sb_add(sb, (char *)head, sizeof(int) * 3);
+	err |= sb_add(sb, (char *)p->code, sizeof(instr_t) * p->len);
+	for (a = 0; a < p->ncmds; a++)
+	{
+		c = &p->cmds[a];
+		head[0] = c->line, head[2] = -1, head[3] = c->sub != NULL;
+		for (head[4] = 0; c->redirs && c->redirs[head[4]]; head[4]++)
+			;
+		for (n = 0; c->words && c->words[n]; n++)
+			if (c->words[n] == c->name)
+				head[2] = n;
+		head[1] = c->words ? n : -1;
+		err |= sb_add(sb, (char *)head, sizeof(head));
+		for (n = 0; c->words && c->words[n]; n++)
+			err |= sb_add(sb, c->words[n], strlen(c->words[n]) + 1);
+		for (n = 0; n < head[4]; n++)
+			err |= sb_add(sb, c->redirs[n], strlen(c->redirs[n]) + 1);
+		if (c->sub)
+			err |= prog_save(sb, c->sub);
+	}
+	return (err ? -1 : 0);
+}
+
+/**
+ * prog_load - Deserializes a program saved by prog_save().
+ * @rd: The position in the cache file; moved past the program.
+ *
+ * Return: The program, or NULL if the data is damaged or allocation fails.
+ */
+prog_t *prog_load(cachereader_t *rd)
+{
+	prog_t *p = prog_new();
+	int a, head[3];
+
+	if (!p)
+		return (NULL);
+	if (load_bytes(rd, head, sizeof(head)) || head[0] < 1 || head[1] < 0 ||
+			head[2] < 0 || (size_t)head[0] > (size_t)(rd->end - rd->p))
+		return (prog_free(p), NULL);
+	p->code = malloc(sizeof(instr_t) * head[0]);
+	p->cmds = malloc(sizeof(cmd_t) * (head[1] + 1));
+	if (!p->code || !p->cmds)
+		return (prog_free(p), NULL);
+	memset(p->cmds, 0, sizeof(cmd_t) * (head[1] + 1));
+	p->len = p->cap = head[0];
+	p->ncmds = p->cmdcap = head[1];
+	p->loops = head[2];
+	if (load_bytes(rd, p->code, sizeof(instr_t) * p->len))
+		return (prog_free(p), NULL);
+	for (a = 0; a < p->ncmds; a++)
+		if (load_cmd(rd, &p->cmds[a]))
+			return (prog_free(p), NULL);
+	if (prog_check(p))
+		return (prog_free(p), NULL);
+	return (p);
+}
+
+/**
+ * load_cmd - Deserializes one command of a program.
+ * @rd: The position in the cache file.
+ * @c: Receives the command; whatever was loaded is freed with it.
+ *
+ * Return: 0 on success, -1 on failure.
+ */
+int load_cmd(cachereader_t *rd, cmd_t *c)
+{
+	int head[5];
+
+	if (load_bytes(rd, head, sizeof(head)) || head[1] < -1 || head[4] < 0 ||
+			(head[1] > 0 && (size_t)head[1] > (size_t)(rd->end - rd->p)) ||
+			(size_t)head[4] > (size_t)(rd->end - rd->p))
+		return (-1);
+	c->line = head[0];
+	if (head[1] >= 0 && !(c->words = load_words(rd, head[1])))
+		return (-1);
+	if (head[4] && !(c->redirs = load_words(rd, head[4])))
+		return (-1);
+	if (head[2] >= 0 && head[2] < head[1])
+	{
+		c->name = c->words[head[2]];
+		c->builtin = builtin_find(c->name);
+	}
+	if (head[3])
+		c->sub = prog_load(rd);
+	return (head[3] && !c->sub ? -1 : 0);
+}
+
+/**
+ * load_bytes - Copies bytes out of a cache file.
+ * @rd: The position in the cache file; moved past the bytes.
+ * @dst: Receives the bytes.
+ * @n: The number of bytes.
+ *
+ * Return: 0 on success, -1 if the file ends first.
+ */
+int load_bytes(cachereader_t *rd, void *dst, size_t n)
+{
+	if ((size_t)(rd->end - rd->p) < n)
+		return (-1);
+	memcpy(dst, rd->p, n);
+	rd->p += n;
+	return (0);
+}
+
+/**
+ * load_string - Copies a NUL-terminated string out of a cache file.
+ * @rd: The position in the cache file; moved past the string.
+ *
+ * Return: The allocated string, or NULL if the file ends first.
+ */
+char *load_string(cachereader_t *rd)
+{
+	const char *nul = memchr(rd->p, '\0', rd->end - rd->p);
+	char *s;
+
+	if (!nul)
+		return (NULL);
+	s = dupStrn(rd->p);
+	rd->p = nul + 1;
+	return (s);
+}
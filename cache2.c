@@ -0,0 +1,108 @@
+#include "myshell.h"
+
+/**
+ * prog_check - Checks that a loaded program is safe to run.
+ * @p: The program.
+ *
+ * Every jump must land inside the program and every command index must
+ * name a command holding the words its instruction uses.
+ *
+ * Return: 0 if the program is sound, -1 otherwise.
+ */
+int prog_check(prog_t *p)
+{
+	instr_t *in;
+	int a, cmd, jump;
+
+	if (p->code[p->len - 1].op != OP_END)
+		return (-1);
+	for (a = 0; a < p->len; a++)
+	{
+		in = &p->code[a];
+		if (in->op < OP_END || in->op > OP_COND)
+			return (-1);
+		if (in->op == OP_PIPE && (in->a < 0 || in->b < 2 ||
+					in->b > p->ncmds - in->a || pipe_check(p->cmds + in->a, in->b)))
+			return (-1);
+		cmd = in->op == OP_CMD || in->op == OP_DEFUN || in->op == OP_CASE ||
+			in->op == OP_MATCH || in->op == OP_FOR || in->op == OP_NEXT ||
+			in->op == OP_REDIR || in->op == OP_SUBSHELL ||
+			in->op == OP_COND;
+		jump = in->op == OP_JMP || in->op == OP_JZ || in->op == OP_JNZ ||
+			in->op == OP_AGAIN || in->op == OP_LOOP;
+		if (cmd && (in->a < 0 || in->a >= p->ncmds))
+			return (-1);
+		if (cmd && in->op != OP_CMD && in->op < OP_REDIR &&
+				(!p->cmds[in->a].words ||
+				 (in->op != OP_MATCH && !p->cmds[in->a].words[0])))
+			return (-1);
+		if ((in->op == OP_DEFUN || in->op == OP_SUBSHELL) &&
+				!p->cmds[in->a].sub)
+			return (-1);
+		if (in->op == OP_REDIR && !p->cmds[in->a].redirs)
+			return (-1);
+		if (in->op == OP_COND && (!p->cmds[in->a].words ||
+					!p->cmds[in->a].words[0]))
+			return (-1);
+		if (jump && (in->a < 0 || in->a >= p->len))
+			return (-1);
+		if ((in->op == OP_LOOP || in->op == OP_MATCH || in->op == OP_NEXT ||
+					in->op == OP_REDIR) && (in->b < 0 || in->b >= p->len))
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * cache_count - Counts a use of the compiled-script cache.
+ * @info: The parameter struct holding the counters.
+ * @hit: Non-zero if the compiled form was found, zero if not.
+ *
+ * The counts are shown in $HSH_CACHE_HITS and $HSH_CACHE_MISSES.
+ */
+void cache_count(info_t *info, int hit)
+{
+	char *name = hit ? "HSH_CACHE_HITS" : "HSH_CACHE_MISSES";
+	int n = hit ? ++info->cache_hits : ++info->cache_misses;
+
+	var_set(info, name, strlen(name), number_to_strn(n, 10, 0), 0);
+}
+
+/**
+ * load_words - Deserializes a vector of strings.
+ * @rd: The position in the cache file.
+ * @n: The number of strings.
+ *
+ * Return: The NULL-terminated vector, or NULL on failure.
+ */
+char **load_words(cachereader_t *rd, int n)
+{
+	char **v = malloc(sizeof(char *) * (n + 1));
+	int a;
+
+	if (!v)
+		return (NULL);
+	memset(v, 0, sizeof(char *) * (n + 1));
+	for (a = 0; a < n; a++)
+		if (!(v[a] = load_string(rd)))
+			return (free_strn(v), NULL);
+	return (v);
+}
+
+/**
+ * pipe_check - Checks the stages of a loaded pipeline.
+ * @cmds: The first stage.
+ * @n: The number of stages.
+ *
+ * Return: 0 if every stage is a simple command or a compiled program,
+ *         -1 otherwise.
+ */
+int pipe_check(cmd_t *cmds, int n)
+{
+	int a;
+
+	for (a = 0; a < n; a++)
+		if (!cmds[a].words && !cmds[a].sub)
+			return (-1);
+	return (0);
+}
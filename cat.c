@@ -0,0 +1,162 @@
+#include "myshell.h"
+
+/**
+ * cat_cmd - Writes files to the standard output.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: cat [file...]
+ * With no file, or for a '-', the standard input is copied. The copy is
+ * made in the shell by copy_fd(), without a fork or a user-space copy;
+ * any option hands the command over to the cat program.
+ *
+ * Return: 0 on success, 1 if a file could not be copied, or -1 to run
+ *         the cat program instead.
+ */
+int cat_cmd(info_t *info)
+{
+	int a, ret = 0;
+
+	for (a = 1; a < info->argc; a++)
+		if (info->argv[a][0] == '-' && info->argv[a][1])
+			return (-1);
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	if (info->argc < 2)
+		return (cat_file(info, "-"));
+	for (a = 1; a < info->argc; a++)
+		ret |= cat_file(info, info->argv[a]);
+	return (ret);
+}
+
+/**
+ * cat_file - Copies one file to the standard output.
+ * @info: The parameter struct.
+ * @name: The file, or "-" for the standard input.
+ *
+ * Return: 0 on success, 1 after reporting a failure or once the output
+ *         is a pipe nobody reads.
+ */
+int cat_file(info_t *info, char *name)
+{
+	int fd = strcmp(name, "-") ? open(name, O_RDONLY) : STDIN_FILENO, err = 0;
+	struct stat si, so;
+	char *msg = NULL;
+
+	if (fd == -1)
+		msg = strerror(errno);
+	else if (!fstat(fd, &si) && !fstat(STDOUT_FILENO, &so) &&
+			S_ISREG(si.st_mode) && si.st_dev == so.st_dev &&
+			si.st_ino == so.st_ino && si.st_size)
+		msg = "input file is output file";
+	else if (copy_fd(fd, STDOUT_FILENO))
+		err = errno, msg = strerror(errno);
+	if (fd > STDIN_FILENO)
+		close(fd);
+	if (!msg)
+		return (0);
+	if (err == EPIPE) /* the reader quit, as 'head' does */
+		return (1);
+	fprintf(stderr, "%s: %d: %s: %s: %s\n", info->fname, info->line_count,
+			info->argv[0], name, msg);
+	return (1);
+}
+
+/**
+ * cp_cmd - Copies files.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: cp source dest, or cp source... directory
+ * Each file is copied in the kernel by copy_fd(). Options and directory
+ * sources are handed over to the cp program.
+ *
+ * Return: 0 on success, 1 if a file could not be copied, or -1 to run
+ *         the cp program instead.
+ */
+int cp_cmd(info_t *info)
+{
+	char **argv = info->argv, *dest = argv[info->argc - 1];
+	struct stat st;
+	int a, dir, ret = 0;
+
+	for (a = 1; a < info->argc; a++)
+		if (argv[a][0] == '-' && argv[a][1])
+			return (-1);
+	for (a = 1; a < info->argc - 1; a++)
+		if (!stat(argv[a], &st) && S_ISDIR(st.st_mode))
+			return (-1);
+	dir = !stat(dest, &st) && S_ISDIR(st.st_mode);
+	if (info->argc < 3 || (info->argc > 3 && !dir))
+	{
+		fprintf(stderr, "%s: %d: %s: usage: cp source dest, or cp source... directory\n",
+				info->fname, info->line_count, argv[0]);
+		return (1);
+	}
+	for (a = 1; a < info->argc - 1; a++)
+		ret |= cp_file(info, argv[a], dest, dir);
+	return (ret);
+}
+
+/**
+ * cp_file - Copies one file.
+ * @info: The parameter struct.
+ * @src: The file copied.
+ * @dest: The copy, or the directory receiving it.
+ * @dir: Non-zero if @dest is a directory.
+ *
+ * A new copy gets the permissions of @src, less the umask; an existing
+ * file keeps its own.
+ *
+ * Return: 0 on success, 1 after reporting a failure.
+ */
+int cp_file(info_t *info, char *src, char *dest, int dir)
+{
+	char *path = dir ? cp_target(src, dest) : dest, *name = src, *msg = NULL;
+	struct stat si, so;
+	int in = open(src, O_RDONLY), out = -1;
+
+	if (in == -1 || fstat(in, &si) || !path)
+		msg = strerror(errno);
+	else if ((out = open(path, O_WRONLY | O_CREAT, si.st_mode & 0777)) == -1)
+		msg = strerror(errno), name = path;
+	else if (!fstat(out, &so) && so.st_dev == si.st_dev &&
+			so.st_ino == si.st_ino)
+		msg = "source and destination are the same file";
+	else if (ftruncate(out, 0) || copy_fd(in, out))
+		msg = strerror(errno), name = path;
+	if (in != -1)
+		close(in);
+	if (out != -1 && close(out) && !msg)
+		msg = strerror(errno), name = path;
+	if (msg)
+		fprintf(stderr, "%s: %d: %s: %s: %s\n", info->fname, info->line_count,
+				info->argv[0], name, msg);
+	if (path != dest)
+		free(path);
+	return (msg != NULL);
+}
+
+/**
+ * cp_target - Names the copy of a file made in a directory.
+ * @src: The file copied.
+ * @dir: The directory.
+ *
+ * Return: The path, newly allocated, or NULL if allocation fails.
+ */
+char *cp_target(char *src, char *dir)
+{
+	char *base, *path;
+	size_t n = strlen(src), len = strlen(dir);
+
+	while (n > 1 && src[n - 1] == '/')
+		n--;
+	for (base = src + n; base > src && base[-1] != '/'; base--)
+		;
+	path = malloc(len + (src + n - base) + 2);
+	if (!path)
+		return (NULL);
+	memcpy(path, dir, len);
+	path[len] = '/';
+	memcpy(path + len + 1, base, src + n - base);
+	path[len + 1 + (src + n - base)] = '\0';
+	return (path);
+}
@@ -0,0 +1,95 @@
+#include "myshell.h"
+
+/**
+ * node_new - Allocates an empty command tree node.
+ * @type: The NODE_* kind of the node.
+ * @line: The input line the command starts on.
+ *
+ * Return: The node, or NULL if allocation fails.
+ */
+node_t *node_new(int type, int line)
+{
+	node_t *n = malloc(sizeof(node_t));
+
+	if (!n)
+		return (NULL);
+	memset(n, 0, sizeof(node_t));
+	n->type = type;
+	n->line = line;
+	return (n);
+}
+
+/**
+ * node_free - Frees a list of command tree nodes and their children.
+ * @n: The first node of the list; may be NULL.
+ */
+void node_free(node_t *n)
+{
+	node_t *next;
+
+	for (; n; n = next)
+	{
+		next = n->next;
+		free_strn(n->words);
+		free_strn(n->redirs);
+		free(n->name);
+		node_free(n->left);
+		node_free(n->right);
+		node_free(n->alt);
+		free(n);
+	}
+}
+
+/**
+ * lex_is - Checks whether the current token is a given reserved word.
+ * @lx: The lexer.
+ * @word: The reserved word, e.g. "{" or "function".
+ *
+ * Reserved words are only recognized unquoted, so "{" and \{ are not.
+ *
+ * Return: 1 if the token is @word, 0 otherwise.
+ */
+int lex_is(lexer_t *lx, const char *word)
+{
+	return (lx->tok == TOK_WORD && !strcmp(lx->word, word));
+}
+
+/**
+ * read_command - Reads and parses the next complete command.
+ * @info: The parameter struct holding the input file descriptor.
+ * @tree: Receives the parsed list; NULL for a blank line or on error.
+ *
+ * Lines are read until the command is complete, so a function body or a
+ * quoted string may span several lines; the "> " prompt asks for more in
+ * interactive mode.
+ *
+ * Return: PARSE_OK, PARSE_ERROR, or -1 at the end of the input.
+ */
+int read_command(info_t *info, node_t **tree)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	int status = PARSE_MORE, line = info->input_line + 1;
+	ssize_t r = 0;
+
+	*tree = NULL;
+	while (status == PARSE_MORE)
+	{
+		if (sb.len && handleInteract(info))
+		{
+			prnt_strn("> ");
+			wrt_chr(BUFFER_FLUSH);
+		}
+		r = inputGet(info);
+		if (r == -1)
+			break;
+		sb_add(&sb, info->arg, r);
+		sb_addc(&sb, '\n');
+		status = parse_program(info, sb.s, line, tree);
+	}
+	free(sb.s);
+	if (r != -1 || !sb.len)
+		return (r == -1 ? -1 : status);
+	fprintf(stderr, "%s: %d: Syntax error: end of file unexpected\n",
+			info->fname, info->input_line);
+	return (PARSE_ERROR);
+}
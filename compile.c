@@ -0,0 +1,130 @@
+#include "myshell.h"
+
+/**
+ * prog_new - Allocates an empty program.
+ *
+ * Return: The program, with one reference, or NULL if allocation fails.
+ */
+prog_t *prog_new(void)
+{
+	prog_t *p = malloc(sizeof(prog_t));
+
+	if (!p)
+		return (NULL);
+	memset(p, 0, sizeof(prog_t));
+	p->refs = 1;
+	return (p);
+}
+
+/**
+ * prog_free - Drops a reference to a program.
+ * @p: The program; may be NULL.
+ *
+ * The program and the function bodies it defines are freed with the
+ * last reference.
+ */
+void prog_free(prog_t *p)
+{
+	int a;
+
+	if (!p || --p->refs > 0)
+		return;
+	for (a = 0; a < p->ncmds; a++)
+	{
+		free_strn(p->cmds[a].words);
+		free_strn(p->cmds[a].redirs);
+		prog_free(p->cmds[a].sub);
+	}
+	free(p->cmds);
+	free(p->code);
+	free(p);
+}
+
+/**
+ * prog_emit - Appends an instruction to a program.
+ * @p: The program being compiled.
+ * @op: The OP_* operation.
+ * @a: The first operand.
+ * @b: The second operand.
+ *
+ * Return: The index of the instruction, for patching jump targets later,
+ *         or -1 if allocation fails (p->err is then set).
+ */
+int prog_emit(prog_t *p, int op, int a, int b)
+{
+	instr_t *code;
+
+	if (p->len == p->cap)
+	{
+		code = realloc(p->code, sizeof(instr_t) * (p->cap ? p->cap * 2 : 16));
+		if (!code)
+			return (p->err = 1, -1);
+		p->code = code;
+		p->cap = p->cap ? p->cap * 2 : 16;
+	}
+	p->code[p->len].op = op;
+	p->code[p->len].a = a;
+	p->code[p->len].b = b;
+	return (p->len++);
+}
+
+/**
+ * prog_cmd - Adds a command or word list to a program.
+ * @p: The program being compiled.
+ * @words: The words as written; ownership passes to the program.
+ * @line: The input line of the command.
+ *
+ * When the command name needs no expansion its builtin is looked up now,
+ * so running the command does not search the builtin table again.
+ *
+ * Return: The index of the command, or -1 on failure (@words is freed).
+ */
+int prog_cmd(prog_t *p, char **words, int line)
+{
+	cmd_t *cmds, *c;
+	int a;
+
+	if (p->ncmds == p->cmdcap)
+	{
+		cmds = realloc(p->cmds, sizeof(cmd_t) * (p->cmdcap ? p->cmdcap * 2 : 8));
+		if (!cmds)
+			return (free_strn(words), p->err = 1, -1);
+		p->cmds = cmds;
+		p->cmdcap = p->cmdcap ? p->cmdcap * 2 : 8;
+	}
+	c = &p->cmds[p->ncmds];
+	memset(c, 0, sizeof(cmd_t));
+	c->words = words;
+	c->line = line;
+	for (a = 0; words && words[a] && assign_len(words[a]); a++)
+		;
+	if (words && words[a] && !words[a][strcspn(words[a], "$'\"\\~")])
+	{
+		c->name = words[a];
+		c->builtin = builtin_find(c->name);
+	}
+	return (p->ncmds++);
+}
+
+/**
+ * compile_program - Compiles a parsed command list to bytecode.
+ * @tree: The list; its words move into the program, so the tree must
+ *        only be freed afterwards.
+ *
+ * Return: The program, or NULL if allocation fails.
+ */
+prog_t *compile_program(node_t *tree)
+{
+	prog_t *p = prog_new();
+
+	if (!p)
+		return (NULL);
+	compile_list(p, tree);
+	prog_emit(p, OP_END, 0, 0);
+	if (p->err)
+	{
+		prog_free(p);
+		return (NULL);
+	}
+	return (p);
+}
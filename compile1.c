@@ -0,0 +1,185 @@
+#include "myshell.h"
+
+/**
+ * compile_list - Compiles every command of a list in order.
+ * @p: The program being compiled.
+ * @n: The first command of the list; may be NULL.
+ */
+void compile_list(prog_t *p, node_t *n)
+{
+	for (; n; n = n->next)
+		compile_node(p, n);
+}
+
+/**
+ * compile_node - Compiles one command of a tree.
+ * @p: The program being compiled.
+ * @n: The command; only this node, not the rest of its list.
+ *
+ * && and || become conditional jumps over their right side; a function
+ * definition compiles its body into a program of its own, which
+ * OP_DEFUN stores in the function table when the definition runs.
+ */
+void compile_node(prog_t *p, node_t *n)
+{
+	char **name;
+	int j;
+
+	if (n->redirs && n->type != NODE_SIMPLE && n->type != NODE_SUBSHELL)
+		compile_redir(p, n);
+	else if (n->type == NODE_SIMPLE)
+	{
+		j = prog_cmd(p, n->words, n->line);
+		if (j >= 0)
+			p->cmds[j].redirs = n->redirs, n->redirs = NULL;
+		prog_emit(p, OP_CMD, j, 0);
+	}
+	else if (n->type == NODE_AND || n->type == NODE_OR)
+	{
+		compile_node(p, n->left);
+		j = prog_emit(p, n->type == NODE_AND ? OP_JNZ : OP_JZ, 0, 0);
+		compile_node(p, n->right);
+		if (j >= 0)
+			p->code[j].a = p->len;
+	}
+	else if (n->type == NODE_NOT)
+		compile_node(p, n->left), prog_emit(p, OP_NOT, 0, 0);
+	else if (n->type == NODE_GROUP)
+		compile_list(p, n->left);
+	else if (n->type == NODE_IF)
+		compile_if(p, n);
+	else if (n->type == NODE_CASE)
+		compile_case(p, n);
+	else if (n->type == NODE_SUBSHELL)
+		compile_subshell(p, n);
+	else if (n->type == NODE_PIPE)
+		compile_pipe(p, n);
+	else if (n->type == NODE_COND)
+	{
+		prog_emit(p, OP_COND, prog_cmd(p, n->words, n->line), 0);
+		n->words = NULL;
+	}
+	else if (n->type == NODE_FUNC)
+	{
+		name = malloc(sizeof(char *) * 2);
+		if (name)
+			name[0] = n->name, name[1] = NULL, n->name = NULL;
+		j = name ? prog_cmd(p, name, n->line) : (p->err = 1, -1);
+		if (j >= 0)
+			p->cmds[j].sub = compile_program(n->left);
+		if (j >= 0 && !p->cmds[j].sub)
+			p->err = 1;
+		prog_emit(p, OP_DEFUN, j, 0);
+	}
+	else
+		compile_loop(p, n);
+	if (n->type == NODE_SIMPLE)
+		n->words = NULL; /* the program owns them now */
+}
+
+/**
+ * compile_if - Compiles an if command.
+ * @p: The program being compiled.
+ * @n: The NODE_IF node.
+ *
+ * Without an else part the command's status is 0 when no branch runs.
+ */
+void compile_if(prog_t *p, node_t *n)
+{
+	int skip, end = -1;
+
+	compile_list(p, n->left);
+	skip = prog_emit(p, OP_JNZ, 0, 0);
+	compile_list(p, n->right);
+	end = prog_emit(p, OP_JMP, 0, 0);
+	if (skip >= 0)
+		p->code[skip].a = p->len;
+	if (!n->alt)
+		prog_emit(p, OP_TRUE, 0, 0);
+	else if (n->alt->type == NODE_IF && !n->alt->next)
+		compile_if(p, n->alt); /* elif */
+	else
+		compile_list(p, n->alt);
+	if (end >= 0)
+		p->code[end].a = p->len;
+}
+
+/**
+ * compile_loop - Compiles a while, until or for loop.
+ * @p: The program being compiled.
+ * @n: The NODE_WHILE, NODE_UNTIL or NODE_FOR node.
+ *
+ * OP_LOOP pushes a loop entry recording where break and continue go.
+ * The loop body is compiled once and jumped back to by OP_AGAIN, which
+ * also records the body's status as the status of the loop.
+ */
+void compile_loop(prog_t *p, node_t *n)
+{
+	int loop = prog_emit(p, OP_LOOP, 0, 0), top, done, c = -1;
+
+	if (++p->nest > p->loops)
+		p->loops = p->nest;
+	if (n->type == NODE_FOR)
+	{
+		c = prog_cmd(p, for_words(n), n->line);
+		if (c >= 0 && !p->cmds[c].words)
+			p->err = 1;
+		prog_emit(p, OP_FOR, c, 0);
+	}
+	top = p->len;
+	if (n->type == NODE_FOR)
+		done = prog_emit(p, OP_NEXT, c, 0);
+	else
+	{
+		compile_list(p, n->left);
+		done = prog_emit(p, n->type == NODE_WHILE ? OP_JNZ : OP_JZ, 0, 0);
+	}
+	compile_list(p, n->right);
+	prog_emit(p, OP_AGAIN, top, 0);
+	if (done >= 0 && n->type == NODE_FOR)
+		p->code[done].b = p->len;
+	else if (done >= 0)
+		p->code[done].a = p->len;
+	if (loop >= 0)
+		p->code[loop].a = p->len, p->code[loop].b = top;
+	prog_emit(p, OP_POPLOOP, 0, 0);
+	p->nest--;
+}
+
+/**
+ * compile_pipe - Compiles a pipeline.
+ * @p: The program being compiled.
+ * @n: The NODE_PIPE node.
+ *
+ * Every stage becomes one command, and the commands of a pipeline are
+ * consecutive: a simple command keeps its words and redirections, and
+ * any other stage is compiled into a program of its own. OP_PIPE names
+ * the first command and the number of stages.
+ */
+void compile_pipe(prog_t *p, node_t *n)
+{
+	node_t *s, *next;
+	int first = -1, count = 0, j;
+
+	for (s = n->left; s; s = s->next, count++)
+	{
+		j = prog_cmd(p, s->type == NODE_SIMPLE ? s->words : NULL, s->line);
+		if (first < 0)
+			first = j;
+		if (s->type == NODE_SIMPLE)
+			s->words = NULL;
+		if (j < 0)
+			continue;
+		if (s->type == NODE_SIMPLE)
+			p->cmds[j].redirs = s->redirs, s->redirs = NULL;
+		else
+		{
+			next = s->next, s->next = NULL;
+			p->cmds[j].sub = compile_program(s);
+			s->next = next;
+			if (!p->cmds[j].sub)
+				p->err = 1;
+		}
+	}
+	prog_emit(p, OP_PIPE, first, count);
+}
@@ -0,0 +1,116 @@
+#include "myshell.h"
+
+/**
+ * compile_case - Compiles a case command.
+ * @p: The program being compiled.
+ * @n: The NODE_CASE node.
+ *
+ * OP_CASE expands the subject once; each arm is an OP_MATCH that jumps
+ * to the next arm when none of its patterns match. The status is 0 when
+ * no arm matches.
+ */
+void compile_case(prog_t *p, node_t *n)
+{
+	int next, ends = -1, prev;
+	node_t *arm;
+
+	prog_emit(p, OP_CASE, prog_cmd(p, n->words, n->line), 0);
+	n->words = NULL;
+	for (arm = n->right; arm; arm = arm->next)
+	{
+		next = prog_emit(p, OP_MATCH, prog_cmd(p, arm->words, arm->line), 0);
+		arm->words = NULL;
+		compile_list(p, arm->left);
+		if (!arm->left)
+			prog_emit(p, OP_TRUE, 0, 0);
+		/* chain the jumps to esac through their 'a' until it is known */
+		prev = ends;
+		ends = prog_emit(p, OP_JMP, prev, 0);
+		if (next >= 0)
+			p->code[next].b = p->len;
+	}
+	prog_emit(p, OP_TRUE, 0, 0);
+	for (; ends >= 0; ends = prev)
+	{
+		prev = p->code[ends].a;
+		p->code[ends].a = p->len;
+	}
+}
+
+/**
+ * for_words - Builds the word list of a for loop.
+ * @n: The NODE_FOR node; its name and words move into the list.
+ *
+ * Return: A vector holding the variable name followed by the words to
+ *         loop over ("$@" when the loop has no 'in'), or NULL on failure.
+ */
+char **for_words(node_t *n)
+{
+	char **v;
+	size_t a, count = 1;
+
+	for (a = 0; n->words && n->words[a]; a++)
+		;
+	if (n->words)
+		count = a;
+	v = malloc(sizeof(char *) * (count + 2));
+	if (!v)
+		return (NULL);
+	v[0] = n->name;
+	if (n->words)
+		memcpy(v + 1, n->words, sizeof(char *) * count);
+	else
+		v[1] = dupStrn("\"$@\"");
+	v[count + 1] = NULL;
+	free(n->words);
+	n->words = NULL;
+	n->name = NULL;
+	return (v);
+}
+
+/**
+ * compile_redir - Compiles a compound command with redirections.
+ * @p: The program being compiled.
+ * @n: The command; its redirections move into the program.
+ *
+ * OP_REDIR sets the redirections up once for the whole command and
+ * OP_UNREDIR undoes them; when they fail, OP_REDIR jumps past both.
+ */
+void compile_redir(prog_t *p, node_t *n)
+{
+	int j = prog_cmd(p, NULL, n->line), r;
+
+	if (j >= 0)
+		p->cmds[j].redirs = n->redirs;
+	else
+		free_strn(n->redirs);
+	n->redirs = NULL;
+	r = prog_emit(p, OP_REDIR, j, 0);
+	compile_node(p, n);
+	prog_emit(p, OP_UNREDIR, 0, 0);
+	if (r >= 0)
+		p->code[r].b = p->len;
+}
+
+/**
+ * compile_subshell - Compiles a ( list ) subshell.
+ * @p: The program being compiled.
+ * @n: The NODE_SUBSHELL node.
+ *
+ * The list compiles into a program of its own, which OP_SUBSHELL runs in
+ * a child together with the redirections.
+ */
+void compile_subshell(prog_t *p, node_t *n)
+{
+	int j = prog_cmd(p, NULL, n->line);
+
+	if (j >= 0)
+	{
+		p->cmds[j].redirs = n->redirs;
+		n->redirs = NULL;
+		p->cmds[j].sub = compile_program(n->left);
+		if (!p->cmds[j].sub)
+			p->err = 1;
+	}
+	prog_emit(p, OP_SUBSHELL, j, 0);
+}
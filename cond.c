@@ -0,0 +1,143 @@
+#include "myshell.h"
+
+/**
+ * cond_run - Runs a [[ expression ]] conditional command.
+ * @info: The parameter struct.
+ * @cmd: The command; its words are the expression as written.
+ *
+ * The expression is evaluated in the shell, its operands expanded as it
+ * goes without field splitting or globbing, so && and || leave the side
+ * they skip unexpanded. The status is 0 when it is true, 1 when it is
+ * false and 2 on an error.
+ */
+void cond_run(info_t *info, cmd_t *cmd)
+{
+	int pos = 0, r;
+
+	info->line_count = cmd->line;
+	r = cond_or(info, cmd->words, &pos, 1);
+	if (r >= 0 && cmd->words[pos])
+		r = -2;
+	if (r == -2)
+		fprintf(stderr, "%s: %d: [[: syntax error near '%s'\n", info->fname,
+				info->line_count, cmd->words[pos] ? cmd->words[pos] : "]]");
+	info->status = r < 0 ? 2 : !r;
+}
+
+/**
+ * cond_or - Evaluates an expression of a [[ ]] command.
+ * @info: The parameter struct.
+ * @w: The words of the command.
+ * @pos: The index of the first word; it is moved past the expression.
+ * @eval: Zero to only parse the expression, as the skipped side of &&
+ *        or || is.
+ *
+ * Return: 1 if the expression is true, 0 if it is false (or not
+ *         evaluated), -1 after reporting an error, -2 on a syntax error.
+ */
+int cond_or(info_t *info, char **w, int *pos, int eval)
+{
+	int r = cond_and(info, w, pos, eval), s;
+
+	while (r >= 0 && w[*pos] && !strcmp(w[*pos], "||"))
+	{
+		(*pos)++;
+		s = cond_and(info, w, pos, eval && !r);
+		r = s < 0 ? s : r || s;
+	}
+	return (r);
+}
+
+/**
+ * cond_and - Evaluates the operands of && in a [[ ]] command.
+ * @info: The parameter struct.
+ * @w: The words of the command.
+ * @pos: As for cond_or().
+ * @eval: As for cond_or().
+ *
+ * Return: As for cond_or().
+ */
+int cond_and(info_t *info, char **w, int *pos, int eval)
+{
+	int r = cond_not(info, w, pos, eval), s;
+
+	while (r >= 0 && w[*pos] && !strcmp(w[*pos], "&&"))
+	{
+		(*pos)++;
+		s = cond_not(info, w, pos, eval && r);
+		r = s < 0 ? s : r && s;
+	}
+	return (r);
+}
+
+/**
+ * cond_not - Evaluates a ! test or ( expression ) in a [[ ]] command.
+ * @info: The parameter struct.
+ * @w: The words of the command.
+ * @pos: As for cond_or().
+ * @eval: As for cond_or().
+ *
+ * Return: As for cond_or().
+ */
+int cond_not(info_t *info, char **w, int *pos, int eval)
+{
+	int r;
+
+	if (w[*pos] && w[*pos + 1] && !strcmp(w[*pos], "!"))
+	{
+		(*pos)++;
+		r = cond_not(info, w, pos, eval);
+		return (r < 0 ? r : !r);
+	}
+	if (!w[*pos] || strcmp(w[*pos], "("))
+		return (cond_primary(info, w, pos, eval));
+	(*pos)++;
+	r = cond_or(info, w, pos, eval);
+	if (r >= 0 && (!w[*pos] || strcmp(w[*pos], ")")))
+		return (-2);
+	if (r >= 0)
+		(*pos)++;
+	return (r);
+}
+
+/**
+ * cond_primary - Evaluates one test of a [[ ]] command.
+ * @info: The parameter struct.
+ * @w: The words of the command.
+ * @pos: As for cond_or().
+ * @eval: As for cond_or().
+ *
+ * A test is 'word op word' for a binary operator (see cond_binop()),
+ * '-x word' for a unary one (see cond_unary()) or a single word, which
+ * is true when it expands to a non-empty string.
+ *
+ * Return: As for cond_or().
+ */
+int cond_primary(info_t *info, char **w, int *pos, int eval)
+{
+	char **t = w + *pos, *s;
+	int r;
+
+	if (!t[0] || !strcmp(t[0], "&&") || !strcmp(t[0], "||") ||
+			!strcmp(t[0], ")") || !strcmp(t[0], "("))
+		return (-2);
+	if (t[1] && t[2] && cond_binop(t[1]) >= 0)
+	{
+		*pos += 3;
+		return (eval ? cond_binary(info, t[0], cond_binop(t[1]), t[2]) : 0);
+	}
+	if (t[0][0] == '-' && t[0][1] && !t[0][2] && str_chr("nzeafdsrwxLhpSbcvt",
+				t[0][1]) && t[1] && strcmp(t[1], "&&") && strcmp(t[1], "||") &&
+			strcmp(t[1], ")"))
+	{
+		*pos += 2;
+		return (eval ? cond_unary(info, t[0][1], t[1]) : 0);
+	}
+	*pos += 1;
+	if (!eval)
+		return (0);
+	s = cond_word(info, t[0]);
+	r = s ? *s != '\0' : -1;
+	free(s);
+	return (r);
+}
@@ -0,0 +1,160 @@
+#include "myshell.h"
+
+/**
+ * cond_word - Expands an operand of a [[ ]] command.
+ * @info: The parameter struct holding the shell variables.
+ * @word: The operand as written.
+ *
+ * Return: The newly allocated value, or NULL on failure.
+ */
+char *cond_word(info_t *info, char *word)
+{
+	return (expand_string(info, word, strlen(word)));
+}
+
+/**
+ * cond_unary - Evaluates a unary test of a [[ ]] command.
+ * @info: The parameter struct holding the shell variables.
+ * @op: The letter of the operator: n and z test the length of a string,
+ *      v whether a variable is set, t whether a descriptor is a terminal,
+ *      r, w and x the access to a file, e and a whether it exists, s
+ *      whether it is not empty and the others its type.
+ * @word: The operand as written.
+ *
+ * Return: 1 if the test is true, 0 if it is false, -1 on failure.
+ */
+int cond_unary(info_t *info, char op, char *word)
+{
+	static char types[] = "fdLhpSbc";
+	static const mode_t modes[] = {S_IFREG, S_IFDIR, S_IFLNK, S_IFLNK,
+		S_IFIFO, S_IFSOCK, S_IFBLK, S_IFCHR};
+	char *s = cond_word(info, word), *t;
+	struct stat st;
+	int r, found;
+
+	if (!s)
+		return (-1);
+	if (op == 'n' || op == 'z')
+		r = (*s != '\0') == (op == 'n');
+	else if (op == 'v')
+		r = var_value(info, s, strlen(s)) != NULL;
+	else if (op == 't')
+		r = isatty(atoi(s));
+	else if (op == 'r' || op == 'w' || op == 'x')
+		r = !access(s, op == 'r' ? R_OK : op == 'w' ? W_OK : X_OK);
+	else
+	{
+		found = !(op == 'L' || op == 'h' ? lstat(s, &st) : stat(s, &st));
+		t = str_chr(types, op);
+		r = found && (t ? (st.st_mode & S_IFMT) == modes[t - types] :
+				op != 's' || st.st_size > 0);
+	}
+	free(s);
+	return (r);
+}
+
+/**
+ * cond_binary - Evaluates a binary test of a [[ ]] command.
+ * @info: The parameter struct holding the shell variables.
+ * @left: The left operand as written.
+ * @op: The operator, as an index from cond_binop().
+ * @right: The right operand as written.
+ *
+ * The right side of ==, = and != is a pattern and that of =~ an extended
+ * regular expression; parts of them that are quoted match literally.
+ *
+ * Return: 1 if the test is true, 0 if it is false, -1 after reporting
+ *         an error.
+ */
+int cond_binary(info_t *info, char *left, int op, char *right)
+{
+	char *l = cond_word(info, left), *r = NULL;
+	int ret = -1;
+
+	if (l && op == COND_REGEX)
+		ret = cond_regex(info, l, right);
+	else if (l && op <= COND_STRNE)
+	{
+		r = expand_pattern(info, right, 0);
+		ret = r ? pattern_match(info, r, l) == (op == COND_STREQ) : -1;
+	}
+	else if (l && (r = cond_word(info, right)) && op <= COND_STRGT)
+		ret = op == COND_STRLT ? strcmp(l, r) < 0 : strcmp(l, r) > 0;
+	else if (l && r && op <= COND_GE)
+		ret = cond_compare(info, l, r, op);
+	else if (l && r)
+		ret = cond_files(l, r, op);
+	free(l);
+	free(r);
+	return (ret);
+}
+
+/**
+ * cond_compare - Compares two integers in a [[ ]] command.
+ * @info: The parameter struct holding the shell variables.
+ * @l: The left value.
+ * @r: The right value.
+ * @op: The operator, from COND_EQ to COND_GE.
+ *
+ * A value that is a variable name stands for the variable's value, and
+ * an empty value or unset variable for 0.
+ *
+ * Return: 1 if the comparison holds, 0 if not, -1 after reporting that
+ *         a value is not an integer.
+ */
+int cond_compare(info_t *info, char *l, char *r, int op)
+{
+	char *s[2], *end, *v;
+	long n[2];
+	int a;
+
+	s[0] = l, s[1] = r;
+	for (a = 0; a < 2; a++)
+	{
+		v = *s[a] && !s[a][var_name_len(s[a])] ?
+			var_value(info, s[a], strlen(s[a])) : s[a];
+		n[a] = v ? strtol(v, &end, 10) : 0;
+		if (v && *v && !*end)
+			continue;
+		if (v && *v)
+		{
+			fprintf(stderr, "%s: %d: [[: %s: integer expression expected\n",
+					info->fname, info->line_count, s[a]);
+			return (-1);
+		}
+		n[a] = 0;
+	}
+	if (op == COND_EQ || op == COND_NE)
+		return ((n[0] == n[1]) == (op == COND_EQ));
+	if (op == COND_LE || op == COND_GT)
+		return ((n[0] <= n[1]) == (op == COND_LE));
+	return ((n[0] < n[1]) == (op == COND_LT));
+}
+
+/**
+ * cond_files - Compares two files in a [[ ]] command.
+ * @l: The left file name.
+ * @r: The right file name.
+ * @op: COND_NT (newer than), COND_OT (older than) or COND_EF (the same
+ *      file).
+ *
+ * A file that exists is newer than one that does not.
+ *
+ * Return: 1 if the comparison holds, 0 if not.
+ */
+int cond_files(char *l, char *r, int op)
+{
+	struct stat a, b;
+	int la = !stat(l, &a), lb = !stat(r, &b), cmp;
+
+	if (op == COND_EF)
+		return (la && lb && a.st_dev == b.st_dev && a.st_ino == b.st_ino);
+	if (!la || !lb)
+		cmp = la - lb;
+	else if (a.st_mtim.tv_sec != b.st_mtim.tv_sec)
+		cmp = a.st_mtim.tv_sec < b.st_mtim.tv_sec ? -1 : 1;
+	else
+		cmp = (a.st_mtim.tv_nsec > b.st_mtim.tv_nsec) -
+			(a.st_mtim.tv_nsec < b.st_mtim.tv_nsec);
+	return (op == COND_NT ? cmp > 0 : cmp < 0);
+}
@@ -0,0 +1,146 @@
+#include "myshell.h"
+
+/**
+ * cond_binop - Recognizes a binary operator of a [[ ]] command.
+ * @word: The word as written.
+ *
+ * Return: The COND_* index of the operator, or -1 if @word is not one.
+ */
+int cond_binop(char *word)
+{
+	static const char * const names[] = {"==", "=", "!=", "=~", "<", ">",
+		"-eq", "-ne", "-lt", "-le", "-gt", "-ge", "-nt", "-ot", "-ef", NULL};
+	static const int ops[] = {COND_STREQ, COND_STREQ, COND_STRNE, COND_REGEX,
+		COND_STRLT, COND_STRGT, COND_EQ, COND_NE, COND_LT, COND_LE, COND_GT,
+		COND_GE, COND_NT, COND_OT, COND_EF};
+	int a;
+
+	for (a = 0; names[a]; a++)
+		if (!strcmp(names[a], word))
+			return (ops[a]);
+	return (-1);
+}
+
+/**
+ * cond_regex - Matches a string against an =~ operand.
+ * @info: The parameter struct holding the compiled expressions.
+ * @s: The string.
+ * @word: The extended regular expression as written; quoted parts of it
+ *        match literally.
+ *
+ * BASH_REMATCH is set to the match and the subexpressions' matches, or
+ * emptied when there is none.
+ *
+ * Return: 1 if @s matches, 0 if not, -1 after reporting an invalid
+ *         expression.
+ */
+int cond_regex(info_t *info, char *s, char *word)
+{
+	char *text = expand_pattern(info, word, 1);
+	condregex_t *re = text ? regex_get(info, text) : NULL;
+	regmatch_t *m;
+	size_t n;
+	int r;
+
+	if (re && !re->ok)
+		fprintf(stderr, "%s: %d: [[: %s: invalid regular expression\n",
+				info->fname, info->line_count, text);
+	free(text);
+	if (!re || !re->ok)
+		return (-1);
+	n = re->re.re_nsub + 1;
+	m = malloc(sizeof(regmatch_t) * n);
+	if (!m)
+		return (-1);
+	r = !regexec(&re->re, s, n, m, 0);
+	cond_rematch(info, s, m, r ? n : 0);
+	free(m);
+	return (r);
+}
+
+/**
+ * cond_rematch - Sets BASH_REMATCH after an =~ test.
+ * @info: The parameter struct holding the shell variables.
+ * @s: The string matched.
+ * @m: The matches.
+ * @n: The number of @m: 0 when @s did not match.
+ */
+void cond_rematch(info_t *info, char *s, regmatch_t *m, size_t n)
+{
+	var_t *v = array_var(info, "BASH_REMATCH", 12, ARRAY_DENSE, 0);
+	strbuf_t sb = {NULL, 0, 0};
+	size_t a;
+
+	if (!v || v->array->kind == ARRAY_ASSOC)
+		return;
+	array_free(v->array);
+	v->array = array_new(ARRAY_DENSE);
+	for (a = 0; v->array && a < n; a++)
+	{
+		if (m[a].rm_so >= 0)
+			sb_add(&sb, s + m[a].rm_so, m[a].rm_eo - m[a].rm_so);
+		array_index_set(v->array, a, sb_take(&sb));
+	}
+}
+
+/**
+ * regex_get - Compiles a regular expression, or reuses a compiled one.
+ * @info: The parameter struct holding the compiled expressions.
+ * @text: The extended regular expression.
+ *
+ * The expressions are kept most recently used first; a hit moves to the
+ * front and once REGEX_MAX are kept the last one is dropped. One that
+ * does not compile is kept too, so it is not compiled again.
+ *
+ * Return: The expression (owned by the list), or NULL if allocation
+ *         fails.
+ */
+condregex_t *regex_get(info_t *info, const char *text)
+{
+	condregex_t **p, *re;
+	int n = 0;
+
+	for (p = &info->regexes; *p; p = &(*p)->next, n++)
+		if (!strcmp((*p)->text, text))
+		{
+			re = *p;
+			*p = re->next;
+			re->next = info->regexes;
+			info->regexes = re;
+			return (re);
+		}
+	for (p = &info->regexes; n >= REGEX_MAX && (*p)->next; p = &(*p)->next)
+		;
+	if (n >= REGEX_MAX)
+		regexes_free(p);
+	re = malloc(sizeof(condregex_t));
+	if (!re)
+		return (NULL);
+	re->text = dupStrn(text);
+	if (!re->text)
+		return (free(re), NULL);
+	re->ok = !regcomp(&re->re, text, REG_EXTENDED);
+	re->next = info->regexes;
+	info->regexes = re;
+	return (re);
+}
+
+/**
+ * regexes_free - Frees compiled regular expressions.
+ * @list: The list; the expressions from here on are freed and it is left
+ *        empty.
+ */
+void regexes_free(condregex_t **list)
+{
+	condregex_t *re;
+
+	while (*list)
+	{
+		re = *list;
+		*list = re->next;
+		if (re->ok)
+			regfree(&re->re);
+		free(re->text);
+		free(re);
+	}
+}
@@ -70,8 +70,8 @@ int cd(info_t *info)
 	}
 	else
 	{/* Set "OLDPWD" to the previous current directory. */
-		setenv("OLDPWD", get_env(info, "PWD="), 1); /* Update "OLDPWD" */
-		setenv("PWD", getcwd(buff, sizeof(buff)), 1); /* Set the new "PWD" */
+		set_env(info, "OLDPWD", get_env(info, "PWD=")); /* Update "OLDPWD" */
+		set_env(info, "PWD", getcwd(buff, sizeof(buff))); /* Set the new "PWD" */
 	}
 	return (0);
 }
@@ -94,7 +94,7 @@ int exit_cmd(info_t *info)
 			printErro(info, "Illegal number: ");
 			_errputs(info->argv[1]);
 			_errputchar('\n');
-			return (1);
+			return (2);
 		}
 		info->err_number = err_atoi(info->argv[1]);
 		return (-2); /* Indicates exit with the specified status */
@@ -0,0 +1,175 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+
+/**
+ * coproc_cmd - Starts a command that runs beside the shell.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: coproc [NAME] command [args...]
+ * The command keeps running in a child whose standard input and output
+ * are pipes to the shell: NAME[0] reads what it writes, NAME[1] writes
+ * what it reads and NAME_PID is its process ID, so a loop can feed one
+ * helper request after request instead of starting it on every pass.
+ * NAME defaults to COPROC; the first word is only taken as the name when
+ * a command follows it and it is not a command itself. Starting another
+ * coprocess under the same name closes the old one's pipes.
+ *
+ * Return: 0 once started, 1 on failure, 2 on a usage error.
+ */
+int coproc_cmd(info_t *info)
+{
+	char **argv = info->argv, *name = "COPROC";
+	int a = 1, fds[2];
+	coproc_t *c;
+
+	coproc_reap(info);
+	if (argv[1] && argv[2] && coproc_isname(info, argv[1]))
+		name = argv[a++];
+	if (!argv[a])
+		return (printErro(info, "usage: coproc [NAME] command [args...]"), 2);
+	for (c = info->coprocs; c; c = c->next)
+		if (c->name && !strcmp(c->name, name))
+		{
+			coproc_close(info, c->rfd), coproc_close(info, c->wfd);
+			free(c->name), c->name = NULL;
+		}
+	c = malloc(sizeof(coproc_t));
+	if (!c)
+		return (1);
+	c->name = dupStrn(name);
+	c->pid = coproc_spawn(info, argv + a, fds);
+	if (!c->name || c->pid == -1)
+		return (free(c->name), free(c), 1);
+	c->rfd = fds[0], c->wfd = fds[1];
+	c->next = info->coprocs;
+	info->coprocs = c;
+	return (coproc_vars(info, c));
+}
+
+/**
+ * coproc_isname - Checks whether a word of a coproc line is its NAME.
+ * @info: The parameter struct holding the functions and the PATH.
+ * @word: The first word after 'coproc'.
+ *
+ * Return: 1 if @word is a variable name that is not also a function, a
+ *         builtin or a program in the PATH, 0 otherwise.
+ */
+int coproc_isname(info_t *info, char *word)
+{
+	char *path;
+
+	if (!*word || word[var_name_len(word)] || func_find(info, word) ||
+			builtin_find(word))
+		return (0);
+	path = lookFor_path(info, get_env(info, "PATH="), word);
+	if (path && path != word)
+		free(path);
+	return (!path);
+}
+
+/**
+ * coproc_spawn - Forks the child running a coprocess.
+ * @info: The parameter struct.
+ * @argv: The command and its arguments.
+ * @fds: Receives the shell's ends: fds[0] reads the child's output and
+ *       fds[1] writes its input. Both are above REDIR_FDS and closed on
+ *       exec, so later commands only see them when redirected to.
+ *
+ * Return: The child's process ID, or -1 on failure.
+ */
+pid_t coproc_spawn(info_t *info, char **argv, int *fds)
+{
+	int in[2], out[2], a;
+	pid_t pid;
+	coproc_t *c;
+
+	if (pipe2(in, O_CLOEXEC))
+		return (perror("Error:"), -1);
+	if (pipe2(out, O_CLOEXEC))
+		return (perror("Error:"), close(in[0]), close(in[1]), -1);
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	pid = fork();
+	if (!pid)
+	{
+		dup2(in[0], STDIN_FILENO);
+		dup2(out[1], STDOUT_FILENO);
+		for (a = 0; a < 2; a++)
+			close(in[a]), close(out[a]);
+		for (c = info->coprocs; c; c = c->next) /* a function keeps no others */
+			coproc_close(info, c->rfd), coproc_close(info, c->wfd);
+		signal(SIGPIPE, SIG_DFL);
+		for (info->argc = 0; argv[info->argc]; info->argc++)
+			;
+		info->argv = argv;
+		info->nofork = 1;
+		exec_command(info, NULL);
+		subshell_exit(info);
+	}
+	if (pid == -1)
+		perror("Error:");
+	fds[0] = pid == -1 ? -1 : fcntl(out[0], F_DUPFD_CLOEXEC, REDIR_FDS);
+	fds[1] = pid == -1 ? -1 : fcntl(in[1], F_DUPFD_CLOEXEC, REDIR_FDS);
+	for (a = 0; a < 2; a++)
+		close(in[a]), close(out[a]);
+	return (pid);
+}
+
+/**
+ * coproc_vars - Sets the variables naming a coprocess.
+ * @info: The parameter struct holding the shell variables.
+ * @c: The coprocess.
+ *
+ * Return: 0 on success, 1 if a variable could not be set.
+ */
+int coproc_vars(info_t *info, coproc_t *c)
+{
+	size_t len = lenstrn(c->name);
+	char *pidname = malloc(len + 5);
+	var_t *v = array_var(info, c->name, len, ARRAY_DENSE, 0);
+	int ret = 1;
+
+	if (v && v->array->kind != ARRAY_ASSOC)
+	{
+		array_free(v->array);
+		v->array = array_new(ARRAY_DENSE);
+		ret = !v->array ||
+			array_index_set(v->array, 0, dupStrn(number_to_strn(c->rfd, 10, 0))) ||
+			array_index_set(v->array, 1, dupStrn(number_to_strn(c->wfd, 10, 0)));
+	}
+	if (!pidname)
+		return (1);
+	memcpy(pidname, c->name, len);
+	memcpy(pidname + len, "_PID", 5);
+	if (!var_set(info, pidname, len + 4, number_to_strn(c->pid, 10, 0), 0))
+		ret = 1;
+	free(pidname);
+	return (ret);
+}
+
+/**
+ * coproc_reap - Forgets the coprocesses that are over.
+ * @info: The parameter struct holding the coprocesses.
+ *
+ * A finished child is waited for at once, but its pipes stay open until
+ * closed with 'exec N>&-', so output it left behind can still be read.
+ */
+void coproc_reap(info_t *info)
+{
+	coproc_t **p = &info->coprocs, *c;
+
+	while (*p)
+	{
+		c = *p;
+		if (c->pid > 0 && waitpid(c->pid, NULL, WNOHANG) == c->pid)
+			c->pid = 0;
+		if (c->pid > 0 || c->rfd != -1 || c->wfd != -1)
+		{
+			p = &c->next;
+			continue;
+		}
+		*p = c->next;
+		free(c->name);
+		free(c);
+	}
+}
@@ -0,0 +1,78 @@
+#include "myshell.h"
+
+/**
+ * coproc_owns - Checks whether a descriptor is a coprocess pipe.
+ * @info: The parameter struct holding the coprocesses.
+ * @fd: The descriptor.
+ *
+ * Redirections may name these even though they are above REDIR_FDS.
+ *
+ * Return: 1 if @fd is an open end of a coprocess pipe, 0 otherwise.
+ */
+int coproc_owns(info_t *info, long fd)
+{
+	coproc_t *c;
+
+	for (c = info->coprocs; c && fd >= 0; c = c->next)
+		if (c->rfd == fd || c->wfd == fd)
+			return (1);
+	return (0);
+}
+
+/**
+ * coproc_close - Closes an end of a coprocess pipe.
+ * @info: The parameter struct holding the coprocesses.
+ * @fd: The descriptor; closing NAME[1] gives the coprocess end of file.
+ *
+ * Return: 1 if @fd was a coprocess pipe and is now closed, 0 otherwise.
+ */
+int coproc_close(info_t *info, long fd)
+{
+	coproc_t *c;
+
+	for (c = info->coprocs; c && fd >= 0; c = c->next)
+		if (c->rfd == fd || c->wfd == fd)
+		{
+			close(fd);
+			if (c->rfd == fd)
+				c->rfd = -1;
+			else
+				c->wfd = -1;
+			return (1);
+		}
+	return (0);
+}
+
+/**
+ * redir_named - Carries out a redirection of a {NAME} descriptor.
+ * @info: The parameter struct holding the shell variables.
+ * @r: The redirection, "{NAME}" followed by its kind and operand.
+ *
+ * Only closing is supported, as in '{COPROC[1]}>&-', and only for a
+ * coprocess pipe; it stays closed after the command.
+ *
+ * Return: 0 on success, -1 after reporting a failure.
+ */
+int redir_named(info_t *info, char *r)
+{
+	size_t len = strcspn(r, "}");
+	char *ref = malloc(len + 3), *val, *end;
+	long fd = -1;
+
+	if (!ref)
+		return (-1);
+	sprintf(ref, "${%.*s}", (int)len - 1, r + 1);
+	val = expand_string(info, ref, len + 2);
+	if (val && *val)
+		fd = strtol(val, &end, 10);
+	if (!val || !*val || *end || strcmp(r + len + 1, "d-") ||
+			!coproc_close(info, fd))
+	{
+		fprintf(stderr, "%s: %d: %s: Bad file descriptor\n", info->fname,
+				info->line_count, val && *val ? val : ref);
+		fd = -1;
+	}
+	free(ref);
+	free(val);
+	return (fd == -1 ? -1 : 0);
+}
@@ -0,0 +1,112 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+#include <sys/sendfile.h>
+
+/**
+ * copy_fd - Copies everything left in one descriptor to another.
+ * @in: The descriptor read from its current offset.
+ * @out: The descriptor written at its current offset.
+ *
+ * The data stays in the kernel whenever it can: copy_file_range() from
+ * file to file, which may share the blocks instead of copying them,
+ * sendfile() from a file to anything else, and splice() when either end
+ * is a pipe. An appending file is written at its end with O_APPEND
+ * cleared for the copy, since those calls refuse it. Anything they do
+ * not support falls back to read() and write().
+ *
+ * Return: 0 on success, -1 on failure with errno set.
+ */
+int copy_fd(int in, int out)
+{
+	struct stat si, so;
+	int how = -1, flags = -1;
+	ssize_t n = -2;
+
+	if (!fstat(in, &si) && !fstat(out, &so))
+	{
+		if (S_ISREG(si.st_mode))
+			how = S_ISREG(so.st_mode) ? COPY_RANGE : COPY_SENDFILE;
+		else if (S_ISFIFO(si.st_mode) || S_ISFIFO(so.st_mode))
+			how = COPY_SPLICE;
+		if (how == COPY_RANGE)
+			flags = fcntl(out, F_GETFL);
+		if (flags != -1 && flags & O_APPEND &&
+				(fcntl(out, F_SETFL, flags & ~O_APPEND) ||
+				 lseek(out, 0, SEEK_END) == -1))
+			how = -1;
+	}
+	if (how != -1)
+		n = copy_kernel(in, out, how);
+	if (n == -2 && how == COPY_RANGE) /* e.g. across file systems */
+		n = copy_kernel(in, out, COPY_SENDFILE);
+	if (flags != -1 && flags & O_APPEND)
+		fcntl(out, F_SETFL, flags);
+	if (n == -2)
+		return (copy_rw(in, out));
+	return (n < 0 ? -1 : 0);
+}
+
+/**
+ * copy_kernel - Copies between descriptors without a user-space buffer.
+ * @in: The descriptor read.
+ * @out: The descriptor written.
+ * @how: COPY_RANGE, COPY_SENDFILE or COPY_SPLICE.
+ *
+ * Return: The number of bytes copied, -1 on failure with errno set, or -2
+ *         if the call refused the descriptors before copying anything.
+ */
+ssize_t copy_kernel(int in, int out, int how)
+{
+	ssize_t n, total = 0;
+
+	for (;;)
+	{
+		if (how == COPY_RANGE)
+			n = copy_file_range(in, NULL, out, NULL, COPY_CHUNK, 0);
+		else if (how == COPY_SENDFILE)
+			n = sendfile(out, in, NULL, COPY_CHUNK);
+		else
+			n = splice(in, NULL, out, NULL, COPY_CHUNK,
+					SPLICE_F_MOVE | SPLICE_F_MORE);
+		if (!n)
+			return (total);
+		if (n > 0)
+			total += n;
+		else if (errno != EINTR)
+			return (total || errno == EPIPE || errno == ENOSPC ||
+					errno == EIO ? -1 : -2);
+	}
+}
+
+/**
+ * copy_rw - Copies between descriptors with read() and write().
+ * @in: The descriptor read.
+ * @out: The descriptor written.
+ *
+ * Return: 0 on success, -1 on failure with errno set.
+ */
+int copy_rw(int in, int out)
+{
+	char *buf = malloc(COPY_BUF);
+	ssize_t n, w, done;
+
+	if (!buf)
+		return (-1);
+	while ((n = read(in, buf, COPY_BUF)) != 0)
+	{
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return (free(buf), -1);
+		for (done = 0; done < n; done += w)
+		{
+			w = write(out, buf + done, n - done);
+			if (w < 0 && errno == EINTR)
+				w = 0;
+			else if (w < 0)
+				return (free(buf), -1);
+		}
+	}
+	free(buf);
+	return (0);
+}
@@ -0,0 +1,188 @@
+#include "myshell.h"
+
+/**
+ * cut_cmd - Writes chosen fields or bytes of each line of files.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: cut -f list [-d delim] [-s] [file...], or cut -b|-c list [file...]
+ * With no file, or for a '-', the standard input is read. Fields are
+ * split with memchr(), and only up to the last one the list keeps; as
+ * with coreutils, -c counts bytes. Other options hand the command over to
+ * the cut program, which also reports a list it does not accept.
+ *
+ * Return: 0 on success, 1 if a file could not be read, or -1 to run the
+ *         cut program instead.
+ */
+int cut_cmd(info_t *info)
+{
+	filter_t f;
+	cut_t c;
+	char *line;
+	size_t len;
+	int a = cut_opts(info, &c), k;
+
+	if (a < 0)
+		return (-1);
+	filter_init(info, &f);
+	for (k = a; k == a || k < info->argc; k++)
+	{
+		if (filter_open(&f, k < info->argc ? info->argv[k] : "-"))
+			continue;
+		while (!f.err && filter_line(&f, &line, &len))
+			cut_line(&f, &c, line, len - (line[len - 1] == '\n'));
+		filter_close(&f);
+	}
+	free(c.sel);
+	return (filter_end(&f, f.failed));
+}
+
+/**
+ * cut_opts - Parses the options of a cut command.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @c: Receives the options and the list.
+ *
+ * Return: The index of the first file, or -1 for what this shell leaves
+ *         to the program.
+ */
+int cut_opts(info_t *info, cut_t *c)
+{
+	char **argv = info->argv, *v, *list = NULL;
+	int a, kind = 0, delim = 0;
+
+	c->sel = NULL, c->nsel = 0, c->from = LONG_MAX;
+	c->delim = '\t', c->only = 0;
+	for (a = 1; argv[a] && argv[a][0] == '-' && argv[a][1]; a++)
+	{
+		if (!strcmp(argv[a], "--") && ++a)
+			break;
+		if (!strcmp(argv[a], "-s"))
+		{
+			c->only = 1;
+			continue;
+		}
+		v = argv[a][2] ? argv[a] + 2 : argv[a + 1];
+		if (!v || !str_chr("fbcd", argv[a][1]) ||
+				(argv[a][1] == 'd' ? v[0] == '\0' || v[1] != '\0' : kind))
+			return (-1);
+		if (argv[a][1] == 'd')
+			c->delim = *v, delim = 1;
+		else
+			kind = argv[a][1], list = v;
+		a += !argv[a][2];
+	}
+	if (!kind || ((c->only || delim) && kind != 'f'))
+		return (-1);
+	c->fields = kind == 'f';
+	if (!cut_list(c, list))
+		return (a);
+	free(c->sel);
+	return (-1);
+}
+
+/**
+ * cut_list - Parses the list of a cut command.
+ * @c: Receives the numbers kept.
+ * @list: Numbers and ranges separated by commas: 'n', 'n-m', 'n-', '-m'.
+ *
+ * Return: 0 on success, -1 for a list this shell leaves to the program.
+ */
+int cut_list(cut_t *c, char *list)
+{
+	long lo, hi;
+	char *sel, *item;
+
+	for (;;)
+	{
+		lo = 1, item = list;
+		if (*list != '-' && (*list < '0' || *list > '9'))
+			return (-1);
+		if (*list != '-')
+			lo = strtol(list, &list, 10);
+		hi = lo;
+		if (*list == '-')
+			hi = *++list >= '0' && *list <= '9' ?
+				strtol(list, &list, 10) : LONG_MAX;
+		if (lo < 1 || hi < lo || (*list && *list != ',') ||
+				(*item == '-' && list == item + 1))
+			return (-1);
+		if (hi == LONG_MAX)
+			c->from = lo < c->from ? lo : c->from;
+		else if (hi >= CUT_MAX)
+			return (-1);
+		else
+		{
+			if (hi >= c->nsel)
+			{
+				sel = realloc(c->sel, hi + 1);
+				if (!sel)
+					return (-1);
+				memset(sel + c->nsel, 0, hi + 1 - c->nsel);
+				c->sel = sel, c->nsel = hi + 1;
+			}
+			memset(c->sel + lo, 1, hi - lo + 1);
+		}
+		if (!*list++)
+			return (0);
+	}
+}
+
+/**
+ * cut_line - Writes the parts of a line a cut command keeps.
+ * @f: The filter.
+ * @c: The options and list.
+ * @line: The line.
+ * @n: Its length, without the newline.
+ *
+ * Bytes are written in runs; a line with no delimiter is written whole
+ * unless -s was given.
+ */
+void cut_line(filter_t *f, cut_t *c, char *line, size_t n)
+{
+	char *p = line, *end = line + n, *q;
+	long i;
+	int first = 1;
+
+	if (!c->fields)
+		for (; p < end; p = q)
+		{
+			i = cut_kept(c, p - line + 1);
+			for (q = p + 1; q < end && cut_kept(c, q - line + 1) == i; q++)
+				;
+			if (i)
+				filter_put(f, p, q - p);
+		}
+	else if (!memchr(line, c->delim, n))
+	{
+		if (c->only)
+			return;
+		filter_put(f, line, n);
+	}
+	else
+		for (i = 1; c->from != LONG_MAX || i < c->nsel; i++, p = q + 1)
+		{
+			q = memchr(p, c->delim, end - p);
+			q = q ? q : end;
+			if (cut_kept(c, i))
+			{
+				if (!first)
+					filter_put(f, &c->delim, 1);
+				filter_put(f, p, q - p);
+				first = 0;
+			}
+			if (q == end)
+				break;
+		}
+	filter_put(f, "\n", 1);
+}
+
+/**
+ * cut_kept - Checks whether a cut command keeps a field or byte.
+ * @c: The list.
+ * @i: The number of the field or byte, from 1.
+ *
+ * Return: 1 if it is kept, 0 otherwise.
+ */
+int cut_kept(cut_t *c, long i)
+{
+	return (i >= c->from || (i < c->nsel && c->sel[i]));
+}
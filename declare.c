@@ -0,0 +1,131 @@
+#include "myshell.h"
+
+/**
+ * declare_names - Applies attributes to each NAME[=value] operand.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @flags: VAR_* attribute bits to give every operand.
+ * @local: Non-zero to declare the names in the current function scope.
+ *
+ * Return: 0 on success, 1 if any operand was invalid or readonly.
+ */
+int declare_names(info_t *info, int flags, int local)
+{
+	int a, ret = 0;
+	size_t n;
+	char *arg, *val;
+	var_t *v;
+
+	for (a = 1; info->argv[a]; a++)
+	{
+		arg = info->argv[a];
+		n = var_name_len(arg);
+		if (!n || (arg[n] && arg[n] != '='))
+		{
+			fprintf(stderr, "%s: %d: %s: %s: bad variable name\n",
+					info->fname, info->line_count, info->argv[0], arg);
+			ret = 1;
+			continue;
+		}
+		val = arg[n] == '=' ? arg + n + 1 : NULL;
+		if (local)
+			v = var_local(info, arg, n, val, flags);
+		else
+			v = var_set(info, arg, n, val, flags);
+		if (!v)
+			ret = 1;
+	}
+	return (ret);
+}
+
+/**
+ * export_cmd - Marks variables for export to child processes.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * With no operands the exported variables are listed.
+ *
+ * Return: 0 on success, 1 on error.
+ */
+int export_cmd(info_t *info)
+{
+	if (info->argc == 1)
+		return (print_vars(info, VAR_EXPORT, "export "), 0);
+	return (declare_names(info, VAR_EXPORT, 0));
+}
+
+/**
+ * readonly_cmd - Marks variables readonly.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * With no operands the readonly variables are listed.
+ *
+ * Return: 0 on success, 1 on error.
+ */
+int readonly_cmd(info_t *info)
+{
+	if (info->argc == 1)
+		return (print_vars(info, VAR_READONLY, "readonly "), 0);
+	return (declare_names(info, VAR_READONLY, 0));
+}
+
+/**
+ * local_cmd - Declares variables local to the running function.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Takes the same options as declare, e.g. local -a list=(a b).
+ *
+ * Return: 0 on success, 1 on error.
+ */
+int local_cmd(info_t *info)
+{
+	if (!info->depth)
+	{
+		printErro(info, "can only be used in a function");
+		return (1);
+	}
+	return (declare_cmd(info)); /* declare in a function is local */
+}
+
+/**
+ * unset_cmd - Removes shell variables, array elements or functions.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: unset [-f | -v] NAME...
+ * An operand of the form NAME[sub] removes only that element; with -f
+ * the operands name functions.
+ *
+ * Return: 0 on success, 1 if any variable was readonly.
+ */
+int unset_cmd(info_t *info)
+{
+	int a = 1, ret = 0, funcs = 0;
+	size_t n;
+	char *arg, *close;
+	var_t *v;
+
+	for (; info->argv[a] && (!strcmp(info->argv[a], "-f") ||
+				!strcmp(info->argv[a], "-v")); a++)
+		funcs = info->argv[a][1] == 'f';
+	for (; info->argv[a]; a++)
+	{
+		arg = info->argv[a];
+		if (funcs)
+		{
+			func_unset(info, arg);
+			continue;
+		}
+		n = var_name_len(arg);
+		close = arg[n] == '[' ? str_chr(arg, ']') : NULL;
+		v = close ? var_lookup(info, arg, n) : NULL;
+		if (!v || !v->array)
+		{
+			if (var_unset(info, arg, close ? n : (size_t)lenstrn(arg)))
+				ret = 1;
+			continue;
+		}
+		*close = '\0';
+		array_unset(v->array, arg + n + 1, v->array->kind == ARRAY_ASSOC ? 0 :
+				array_index(info, arg + n + 1));
+		*close = ']';
+	}
+	return (ret);
+}
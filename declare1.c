@@ -0,0 +1,118 @@
+#include "myshell.h"
+
+/**
+ * print_vars - Lists the visible variables carrying an attribute.
+ * @info: The parameter struct holding the shell variables.
+ * @flag: The VAR_* attribute a variable must carry to be listed.
+ * @prefix: Text printed before each entry (e.g. "export ").
+ *
+ * Entries are printed as NAME='value', or just NAME when the variable
+ * has no value.
+ *
+ * Return: The number of variables printed.
+ */
+size_t print_vars(info_t *info, int flag, char *prefix)
+{
+	symtab_t *tab;
+	var_t *v;
+	size_t a, count = 0;
+
+	for (tab = info->vars; tab; tab = tab->parent)
+		for (a = 0; a < tab->size; a++)
+			for (v = tab->bucket[a]; v; v = v->next)
+			{
+				if (!(v->flags & flag) || var_lookup(info, v->pair, v->namelen) != v)
+					continue;
+				prnt_strn(prefix);
+				v->pair[v->namelen] = '\0';
+				prnt_strn(v->pair);
+				v->pair[v->namelen] = '=';
+				if (!(v->flags & VAR_NOVALUE))
+				{
+					prnt_strn("='");
+					prnt_strn(v->pair + v->namelen + 1);
+					wrt_chr('\'');
+				}
+				wrt_chr('\n');
+				count++;
+			}
+	return (count);
+}
+
+/**
+ * declare_flags - Parses the option words of declare/typeset.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @flags: Receives the VAR_EXPORT/VAR_READONLY bits of -x and -r.
+ * @kind: Receives ARRAY_DENSE for -a, ARRAY_ASSOC for -A, -1 otherwise.
+ *
+ * Return: The index of the first operand, or -1 on a bad option.
+ */
+int declare_flags(info_t *info, int *flags, int *kind)
+{
+	int a;
+	char *p;
+
+	*flags = 0;
+	*kind = -1;
+	for (a = 1; info->argv[a] && info->argv[a][0] == '-'; a++)
+		for (p = info->argv[a] + 1; *p; p++)
+		{
+			if (*p == 'x')
+				*flags |= VAR_EXPORT;
+			else if (*p == 'r')
+				*flags |= VAR_READONLY;
+			else if (*p == 'a' && *kind != ARRAY_ASSOC)
+				*kind = ARRAY_DENSE;
+			else if (*p == 'A')
+				*kind = ARRAY_ASSOC;
+			else
+			{
+				fprintf(stderr, "%s: %d: %s: -%c: invalid option\n",
+						info->fname, info->line_count, info->argv[0], *p);
+				return (-1);
+			}
+		}
+	return (a);
+}
+
+/**
+ * declare_cmd - Declares variables and gives them attributes.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: declare [-aAxr] [NAME[=value] | NAME=(...)]...
+ * Inside a function the names are declared local, as in bash.
+ *
+ * Return: 0 on success, 1 on error.
+ */
+int declare_cmd(info_t *info)
+{
+	int a, flags, kind, ret = 0, local = info->depth > 0;
+	size_t n;
+	char *arg;
+
+	a = declare_flags(info, &flags, &kind);
+	if (a < 0)
+		return (2);
+	if (!info->argv[a])
+		return (print_vars(info, flags ? flags : VAR_EXPORT | VAR_READONLY,
+					"declare "), 0);
+	for (; info->argv[a]; a++)
+	{
+		arg = info->argv[a];
+		n = var_name_len(arg);
+		if (!n || (arg[n] && !assign_len(arg)))
+		{
+			fprintf(stderr, "%s: %d: %s: %s: not a valid identifier\n",
+					info->fname, info->line_count, info->argv[0], arg);
+			ret = 1;
+			continue;
+		}
+		if ((kind >= 0 && !array_var(info, arg, n, kind, local)) ||
+				(arg[n] && assign_word(info, arg, local)) ||
+				(!arg[n] && local && !var_local(info, arg, n, NULL, 0)))
+			ret = 1;
+		else if (flags && !(local ? var_local : var_set)(info, arg, n, NULL, flags))
+			ret = 1;
+	}
+	return (ret);
+}
@@ -0,0 +1,132 @@
+#include "myshell.h"
+
+/**
+ * exec_command - Runs the command in info->argv.
+ * @info: The parameter struct holding the expanded 'argv'.
+ * @builtin: The builtin argv[0] was resolved to when compiled, or NULL
+ *           to search the builtin table now.
+ *
+ * Functions are looked up first, then builtins, then the PATH. Only an
+ * external command may take over a pipeline child (info->nofork); the
+ * commands a function or builtin runs must not.
+ */
+void exec_command(info_t *info, int (*builtin)(info_t *))
+{
+	func_t *f = func_find(info, info->argv[0]);
+	int ret = -1, nofork = info->nofork;
+
+	info->nofork = 0;
+	if (f)
+	{
+		func_call(info, f);
+		return;
+	}
+	if (!builtin)
+		builtin = builtin_find(info->argv[0]);
+	if (builtin)
+		ret = run_builtin(info, builtin);
+	if (ret == -2)
+		info->unwind |= UNWIND_EXIT;
+	else if (ret >= 0)
+		info->status = ret;
+	else
+	{
+		info->nofork = nofork;
+		find_command(info);
+	}
+}
+
+/**
+ * run_builtin - Runs a builtin command.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @builtin: The builtin.
+ *
+ * Return: The builtin's status, or -2 if it signals exit().
+ */
+int run_builtin(info_t *info, int (*builtin)(info_t *))
+{
+	int ret;
+
+	/* VAR=value prefixes only last for this one builtin */
+	if (info->assigns)
+		overlay_push(info);
+	ret = builtin(info);
+	if (info->assigns)
+		scope_pop(info);
+	return (ret);
+}
+
+/**
+ * func_call - Runs a shell function in the current shell.
+ * @info: The parameter struct holding the call's 'argv'.
+ * @f: The function.
+ *
+ * The arguments become $1..$N for the duration of the call and a new
+ * scope holds its 'local' variables. The body is the program compiled
+ * when the function was defined. Loops of the caller are out of reach
+ * of 'break' and 'continue' in the body.
+ *
+ * Return: The status of the last command of the body, or of 'return'.
+ */
+int func_call(info_t *info, func_t *f)
+{
+	char **argv = info->argv, **assignv = info->assignv, **posv = info->posv;
+	int argc = info->argc, assigns = info->assigns, posc = info->posc;
+	int loops = info->loops;
+
+	if (info->depth >= FUNC_MAX_DEPTH)
+	{
+		printErro(info, "maximum function nesting level exceeded");
+		return (info->status = 1);
+	}
+	if (assigns) /* VAR=value prefixes last for the whole call */
+		overlay_push(info);
+	scope_push(info);
+	info->posv = argv + 1;
+	info->posc = argc - 1;
+	info->argv = info->assignv = NULL;
+	info->argc = info->assigns = info->loops = 0;
+	info->depth++;
+	vm_run(info, f->body);
+	info->depth--;
+	info->loops = loops;
+	info->unwind &= ~UNWIND_RETURN;
+	scope_pop(info);
+	if (assigns)
+		scope_pop(info);
+	info->argv = argv, info->assignv = assignv, info->posv = posv;
+	info->argc = argc, info->assigns = assigns, info->posc = posc;
+	return (info->status);
+}
+
+/**
+ * break_cmd - Leaves, or goes on with the next round of, enclosing loops.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: break [n] / continue [n]; n defaults to 1.
+ *
+ * Return: 0, or 1 if n is not a positive number.
+ */
+int break_cmd(info_t *info)
+{
+	int n = 1;
+
+	if (!info->loops)
+	{
+		fprintf(stderr, "%s: %d: %s: only meaningful in a loop\n",
+				info->fname, info->line_count, info->argv[0]);
+		return (0);
+	}
+	if (info->argv[1])
+	{
+		n = err_atoi(info->argv[1]);
+		if (n < 1)
+		{
+			printErro(info, "Illegal number");
+			return (1);
+		}
+	}
+	info->levels = n;
+	info->unwind |= *info->argv[0] == 'b' ? UNWIND_BREAK : UNWIND_CONTINUE;
+	return (0);
+}
@@ -0,0 +1,182 @@
+#include "myshell.h"
+
+/**
+ * expand_param - Expands the parameter reference at a '$'.
+ * @info: The parameter struct holding the shell variables.
+ * @p: Pointer to the '$' character.
+ * @sb: The field being built; the value is appended to it.
+ * @out: The finished fields; multi-valued references such as "$@" or
+ *       ${a[@]} push all but their last element here.
+ * @keep: Set to 1 once the field has content worth keeping even if empty.
+ * @quoted: Non-zero inside double quotes (or when splitting is off), where
+ *          values are not split on IFS.
+ *
+ * Handles the special parameters of special_param(), $NAME and the
+ * ${...} forms of expand_braced().
+ *
+ * Return: The number of characters consumed, or 0 if @p does not start
+ *         a parameter reference (the '$' is then literal).
+ */
+size_t expand_param(info_t *info, char *p, strbuf_t *sb, wordlist_t *out,
+		int *keep, int quoted)
+{
+	char *end, *vals[2];
+	size_t n;
+
+	if (p[1] && str_chr("?$#@*0123456789", p[1]))
+	{
+		special_param(info, p + 1, 1, sb, out, keep, quoted);
+		return (2);
+	}
+	if (p[1] == '{')
+	{
+		end = str_chr(p + 2, '}');
+		if (!end || expand_braced(info, p + 2, end - p - 2, sb, out, keep,
+					quoted))
+			return (0);
+		return (end - p + 1);
+	}
+	n = var_name_len(p + 1);
+	if (!n)
+		return (0);
+	vals[0] = var_value(info, p + 1, n);
+	vals[1] = NULL;
+	expand_fields(info, vals[0] ? vals : NULL, sb, out, keep, quoted);
+	return (n + 1);
+}
+
+/**
+ * expand_word - Expands a raw word into zero or more fields.
+ * @info: The parameter struct holding the shell variables.
+ * @word: The word as written, quotes included.
+ * @out: Receives the resulting fields.
+ * @split: Non-zero to split unquoted expansions on IFS (command words),
+ *         zero to keep them whole (assignment values).
+ *
+ * Performs tilde, parameter and array expansion, process substitution
+ * and quote removal. A
+ * word that expands to nothing unquoted (e.g. $UNSET) produces no field,
+ * while "" produces one empty field. When @out->pattern is set, quoted
+ * characters are escaped instead, ready for glob_word().
+ *
+ * Return: The number of fields pushed onto @out.
+ */
+size_t expand_word(info_t *info, char *word, wordlist_t *out, int split)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	size_t n, before = out->n;
+	int keep = 0, dq = 0, multi = 0;
+
+	word += expand_tilde(info, word, &sb, &keep);
+	while (*word)
+	{
+		if (!dq && (*word == '<' || *word == '>') && word[1] == '(' &&
+				(n = procsub_expand(info, word, &sb)))
+		{
+			word += n, keep = 1;
+			continue;
+		}
+		n = *word == '$' ? expand_param(info, word, &sb, out, &keep,
+				dq || !split) : 0;
+		multi |= n && dq && param_is_multi(word, n);
+		keep |= !n && (*word != '"' || (dq && !multi));
+		if (n)
+			word += n;
+		else if (*word == '"') /* "" is an empty field, "$@" may be none */
+			dq = !dq, multi = 0, word++;
+		else if (*word == '\'' && !dq)
+		{
+			for (n = 1; word[n] && word[n] != '\''; n++)
+				;
+			pattern_add(&sb, word + 1, n - 1, out->pattern);
+			word += n + (word[n] == '\'');
+		}
+		else if (*word == '\\' && word[1] && (!dq || str_chr("$\"\\`", word[1])))
+			pattern_add(&sb, word + 1, 1, out->pattern), word += 2;
+		else
+			pattern_add(&sb, word, 1, out->pattern && (dq || *word == '\\')),
+				word++;
+	}
+	if (keep)
+		wl_push(out, sb_take(&sb));
+	else
+		free(sb.s);
+	return (out->n - before);
+}
+
+/**
+ * expand_vector - Expands every word of a NULL-terminated vector.
+ * @info: The parameter struct holding the shell variables.
+ * @vp: Address of the vector; it is replaced by the expanded one.
+ * @split: Non-zero to let a word become several fields and glob them
+ *         (command words), zero to keep exactly one word each
+ *         (assignments).
+ *
+ * Return: The number of words in the new vector.
+ */
+int expand_vector(info_t *info, char ***vp, int split)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	char **v = *vp;
+	size_t a;
+
+	if (!v)
+		return (0);
+	for (a = 0; v[a]; a++)
+	{
+		/* Move over words with nothing to expand, and array lists, */
+		/* whose elements are expanded one by one when assigned */
+		if (!v[a][strcspn(v[a], split ? "$'\"\\~*?[{(" : "$'\"\\~")] ||
+				assign_is_compound(v[a]))
+		{
+			wl_push(&wl, v[a]);
+			continue;
+		}
+		if (split)
+			glob_fields(info, v[a], &wl);
+		else
+			wl_push(&wl, expand_string(info, v[a], strlen(v[a])));
+		free(v[a]);
+	}
+	free(v);
+	if (!wl.v)
+		wl.v = malloc(sizeof(char *));
+	if (wl.v && !wl.n)
+		wl.v[0] = NULL;
+	*vp = wl.v;
+	return (wl.n);
+}
+
+/**
+ * expand_string - Expands a piece of text into a single string.
+ * @info: The parameter struct holding the shell variables.
+ * @s: The raw text to expand.
+ * @len: The number of bytes of @s to expand.
+ *
+ * No IFS splitting is done; multi-valued references such as ${a[@]} are
+ * joined with single spaces.
+ *
+ * Return: A newly allocated string, or NULL on failure.
+ */
+char *expand_string(info_t *info, const char *s, size_t len)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	strbuf_t sb = {NULL, 0, 0};
+	char *text = malloc(len + 1);
+	size_t a;
+
+	if (!text)
+		return (NULL);
+	memcpy(text, s, len);
+	text[len] = '\0';
+	expand_word(info, text, &wl, 0);
+	free(text);
+	for (a = 0; a < wl.n; a++)
+	{
+		if (a)
+			sb_addc(&sb, ' ');
+		sb_add(&sb, wl.v[a], strlen(wl.v[a]));
+	}
+	free_strn(wl.v);
+	return (sb_take(&sb));
+}
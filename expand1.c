@@ -0,0 +1,194 @@
+#include "myshell.h"
+
+/**
+ * expand_braced - Expands the inside of a ${...} reference.
+ * @info: The parameter struct holding the shell variables.
+ * @s: The text between the braces.
+ * @len: Length of @s.
+ * @sb: The field being built.
+ * @out: The finished fields.
+ * @keep: Set to 1 once the field has content worth keeping.
+ * @quoted: Non-zero if the values must not be split on IFS.
+ *
+ * Supports ${name}, ${name[sub]}, ${name[@]}, ${#name}, ${#name[sub]},
+ * ${#name[@]}, ${!name[@]}, the trimming forms of expand_trim() and the
+ * special and positional parameters, e.g. ${10} or ${#}.
+ *
+ * Return: 0 on success, -1 if the text is not a valid reference.
+ */
+int expand_braced(info_t *info, char *s, size_t len, strbuf_t *sb,
+		wordlist_t *out, int *keep, int quoted)
+{
+	int count = (*s == '#' && len > 1), keys = (*s == '!' && len > 1);
+	size_t n, sublen = 0;
+	char *sub = NULL, *one[2] = {NULL, NULL}, **vals = one;
+	var_t *v;
+
+	if (!expand_trim(info, s, len, sb, out, keep, quoted))
+		return (0);
+	s += count + keys;
+	len -= count + keys;
+	for (n = 0; n < len && s[n] >= '0' && s[n] <= '9'; n++)
+		;
+	if (!count && !keys && len && (n == len ||
+				(len == 1 && str_chr("?$#@*", *s))))
+		return (special_param(info, s, len, sb, out, keep, quoted), 0);
+	n = var_name_len(s);
+	if (!n || (n < len && (s[n] != '[' || s[len - 1] != ']' || len < n + 3)))
+		return (-1);
+	if (n < len)
+		sub = s + n + 1, sublen = len - n - 2;
+	v = var_lookup(info, s, n);
+	if (sub && sublen == 1 && (*sub == '@' || *sub == '*'))
+		vals = var_list(v, keys);
+	else
+		one[0] = sub ? subscript_value(info, v, sub, sublen) :
+			var_value(info, s, n);
+	for (n = 0; vals && vals[n]; n++)
+		;
+	if (count) /* the length of ${#name}, the element count of ${#name[@]} */
+	{
+		sub = number_to_strn(vals == one ? lenstrn(one[0]) : (long)n, 10, 0);
+		sb_add(sb, sub, strlen(sub));
+		*keep = 1;
+	}
+	else
+		expand_fields(info, n ? vals : NULL, sb, out, keep, quoted);
+	if (vals != one)
+		free_strn(vals);
+	return (0);
+}
+
+/**
+ * expand_multi - Splices a list of values into the fields being built.
+ * @vals: The values; may be NULL.
+ * @sb: The field being built; it receives the first value and, after the
+ *      others have been pushed, holds the last one.
+ * @out: The finished fields.
+ * @keep: Set to 1 if there was at least one value.
+ */
+void expand_multi(char **vals, strbuf_t *sb, wordlist_t *out, int *keep)
+{
+	size_t a;
+
+	for (a = 0; vals && vals[a]; a++)
+	{
+		if (a)
+			wl_push(out, sb_take(sb));
+		pattern_add(sb, vals[a], strlen(vals[a]), out->pattern);
+		*keep = 1;
+	}
+}
+
+/**
+ * subscript_value - Gets the value of ${name[sub]}.
+ * @info: The parameter struct holding the shell variables.
+ * @v: The variable, or NULL if unset.
+ * @sub: The raw subscript text; parameter references in it are expanded.
+ * @sublen: Length of @sub.
+ *
+ * A scalar behaves like an indexed array holding only element 0.
+ *
+ * Return: The element's value (owned by the shell), or NULL if unset.
+ */
+char *subscript_value(info_t *info, var_t *v, char *sub, size_t sublen)
+{
+	char *key, *value = NULL;
+	long idx = 0;
+
+	if (!v)
+		return (NULL);
+	key = expand_string(info, sub, sublen);
+	if (!key)
+		return (NULL);
+	if (!v->array || v->array->kind != ARRAY_ASSOC)
+		idx = array_index(info, key);
+	if (v->array)
+		value = array_get(v->array, key, idx);
+	else if (!idx && !(v->flags & VAR_NOVALUE))
+		value = v->pair + v->namelen + 1;
+	free(key);
+	return (value);
+}
+
+/**
+ * var_list - Lists the values or keys of a variable as an array.
+ * @v: The variable, or NULL if unset.
+ * @keys: Non-zero to list keys (indices) instead of values.
+ *
+ * A scalar with a value lists as the single element 0.
+ *
+ * Return: A newly allocated vector (free with free_strn()), or NULL if
+ *         the variable is unset or allocation fails.
+ */
+char **var_list(var_t *v, int keys)
+{
+	char **vals;
+
+	if (!v)
+		return (NULL);
+	if (v->array)
+		return (array_list(v->array, keys));
+	if (v->flags & VAR_NOVALUE)
+		return (NULL);
+	vals = malloc(sizeof(char *) * 2);
+	if (!vals)
+		return (NULL);
+	vals[0] = dupStrn(keys ? "0" : v->pair + v->namelen + 1);
+	vals[1] = NULL;
+	return (vals);
+}
+
+/**
+ * expand_trim - Expands ${name#pat}, ${name##pat}, ${name%pat} or
+ *               ${name%%pat}.
+ * @info: The parameter struct holding the shell variables.
+ * @s: The text between the braces.
+ * @len: Length of @s.
+ * @sb: The field being built.
+ * @out: The finished fields.
+ * @keep: Set to 1 once the field has content worth keeping.
+ * @quoted: Non-zero if the value must not be split on IFS.
+ *
+ * The value loses its shortest (# and %) or longest (## and %%) prefix
+ * or suffix matching the pattern. A suffix is matched by running the
+ * pattern backwards from the end of the value.
+ *
+ * Return: 0 if @s is one of these forms, 1 if it is not.
+ */
+int expand_trim(info_t *info, char *s, size_t len, strbuf_t *sb,
+		wordlist_t *out, int *keep, int quoted)
+{
+	size_t n = var_name_len(s), off, vlen;
+	char *one[2] = {NULL, NULL}, *val, *pat = NULL;
+	strbuf_t tail = {NULL, 0, 0};
+	int suffix, longest;
+	pattern_t *p = NULL;
+	long span = 0;
+
+	if (!n || n >= len || (s[n] != '#' && s[n] != '%'))
+		return (1);
+	suffix = s[n] == '%';
+	longest = n + 1 < len && s[n + 1] == s[n];
+	off = n + 1 + longest;
+	val = var_value(info, s, n);
+	if (val && (pat = malloc(len - off + 1)))
+	{
+		memcpy(pat, s + off, len - off);
+		pat[len - off] = '\0';
+		one[0] = expand_pattern(info, pat, 0);
+		p = one[0] ? pattern_get(info, one[0], suffix) : NULL;
+		free(one[0]);
+		vlen = strlen(val);
+		span = p ? pattern_span(p, val, vlen, longest) : -1;
+		span = span < 0 ? 0 : span;
+		if (suffix && !sb_add(&tail, val, vlen - span))
+			one[0] = tail.s;
+		else if (!suffix)
+			one[0] = val + span;
+	}
+	free(pat);
+	expand_fields(info, one[0] ? one : NULL, sb, out, keep, quoted);
+	free(tail.s);
+	return (0);
+}
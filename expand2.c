@@ -0,0 +1,157 @@
+#include "myshell.h"
+
+/**
+ * special_param - Expands a special or positional parameter.
+ * @info: The parameter struct holding the positional parameters.
+ * @name: The parameter name: one of ? $ # @ * or a number.
+ * @len: Length of @name.
+ * @sb: The field being built.
+ * @out: The finished fields.
+ * @keep: Set to 1 once the field has content worth keeping.
+ * @quoted: Non-zero inside double quotes.
+ *
+ * "$@" expands to one field per positional parameter and "$*" to a
+ * single field joining them with spaces.
+ */
+void special_param(info_t *info, char *name, size_t len, strbuf_t *sb,
+		wordlist_t *out, int *keep, int quoted)
+{
+	char *one[2] = {NULL, NULL};
+	long n = 0;
+	int a;
+
+	if (*name == '@' || (*name == '*' && !quoted))
+	{
+		expand_fields(info, info->posc ? info->posv : NULL, sb, out, keep,
+				quoted);
+		return;
+	}
+	if (*name == '*')
+	{
+		for (a = 0; a < info->posc; a++)
+		{
+			if (a)
+				sb_addc(sb, ' ');
+			pattern_add(sb, info->posv[a], strlen(info->posv[a]),
+					out->pattern);
+		}
+		*keep = 1;
+		return;
+	}
+	for (a = 0; a < (int)len && *name >= '0' && *name <= '9'; a++)
+		n = n * 10 + name[a] - '0';
+	if (*name == '?' || *name == '$' || *name == '#')
+		one[0] = number_to_strn(*name == '?' ? info->status : *name == '$' ?
+				(long)getpid() : info->posc, 10, 0);
+	else if (!n)
+		one[0] = info->fname;
+	else if (n <= info->posc)
+		one[0] = info->posv[n - 1];
+	expand_fields(info, one[0] ? one : NULL, sb, out, keep, quoted);
+}
+
+/**
+ * expand_fields - Splices values into the fields being built.
+ * @info: The parameter struct holding IFS.
+ * @vals: The values; may be NULL.
+ * @sb: The field being built.
+ * @out: The finished fields.
+ * @keep: Set to 1 once the field has content worth keeping.
+ * @quoted: Non-zero to keep each value one field (expand_multi()),
+ *          zero to also split every value on IFS (expand_split()).
+ */
+void expand_fields(info_t *info, char **vals, strbuf_t *sb, wordlist_t *out,
+		int *keep, int quoted)
+{
+	size_t a;
+
+	if (quoted)
+	{
+		expand_multi(vals, sb, out, keep);
+		return;
+	}
+	for (a = 0; vals && vals[a]; a++)
+	{
+		if (a && (sb->len || *keep))
+		{
+			wl_push(out, sb_take(sb));
+			*keep = 0;
+		}
+		expand_split(info, vals[a], sb, out, keep);
+	}
+}
+
+/**
+ * expand_split - Appends an unquoted value, splitting it on IFS.
+ * @info: The parameter struct holding IFS.
+ * @value: The value to split.
+ * @sb: The field being built; text before the first separator joins it.
+ * @out: The finished fields.
+ * @keep: Set to 1 once the field has content worth keeping.
+ *
+ * Runs of IFS characters (space, tab and newline when IFS is unset) end
+ * a field and are dropped; an empty IFS disables splitting.
+ */
+void expand_split(info_t *info, char *value, strbuf_t *sb, wordlist_t *out,
+		int *keep)
+{
+	char *ifs = var_value(info, "IFS", 3);
+
+	if (!ifs)
+		ifs = " \t\n";
+	for (; *value; value++)
+	{
+		if (!str_chr(ifs, *value))
+		{
+			sb_addc(sb, *value);
+			*keep = 1;
+		}
+		else if (sb->len || *keep)
+		{
+			wl_push(out, sb_take(sb));
+			*keep = 0;
+		}
+	}
+}
+
+/**
+ * expand_tilde - Expands a leading ~ to the home directory.
+ * @info: The parameter struct holding HOME.
+ * @word: The word as written.
+ * @sb: The field being built.
+ * @keep: Set to 1 when the tilde is expanded.
+ *
+ * Only a bare ~ or a ~/ prefix is expanded; ~user is left alone.
+ *
+ * Return: The number of characters consumed (0 or 1).
+ */
+size_t expand_tilde(info_t *info, char *word, strbuf_t *sb, int *keep)
+{
+	char *home;
+
+	if (word[0] != '~' || (word[1] && word[1] != '/'))
+		return (0);
+	home = var_value(info, "HOME", 4);
+	if (!home)
+		return (0);
+	sb_add(sb, home, strlen(home));
+	*keep = 1;
+	return (1);
+}
+
+/**
+ * param_is_multi - Checks whether a reference may expand to many fields.
+ * @p: The reference, starting at its '$'.
+ * @n: Length of the reference.
+ *
+ * Inside double quotes "$@" and "${a[@]}" expand to nothing at all when
+ * there are no values, unlike "" or "$*", which give one empty field.
+ *
+ * Return: 1 for $@, ${@}, ${name[@]} and ${!name[@]}, 0 otherwise.
+ */
+int param_is_multi(const char *p, size_t n)
+{
+	if (n == 2 || n == 4)
+		return (p[n / 2] == '@');
+	return (n > 6 && p[2] != '#' && !strncmp(p + n - 4, "[@]}", 4));
+}
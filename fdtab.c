@@ -0,0 +1,115 @@
+#include "myshell.h"
+
+/**
+ * exec_cmd - Replaces the shell with a command, or keeps redirections.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: exec [command [args...]]
+ * Without a command the redirections of the exec line stay in effect for
+ * the rest of the shell, so 'exec 3>>log' opens the log once for every
+ * later '>&3'. With one, the command runs in place of the shell, with
+ * the redirections and the prefix assignments.
+ *
+ * Return: 0 when only redirecting; otherwise the command does not
+ *         return, and 127 or 126 means it was not found or not run.
+ */
+int exec_cmd(info_t *info)
+{
+	char **envp, *path;
+
+	if (info->argc < 2)
+	{
+		info->keepfds = 1;
+		return (0);
+	}
+	path = batch_find(info, info->argv[1]);
+	if (!path)
+		return (127);
+	envp = get_environ(info);
+	if (info->assigns)
+		envp = overlay_envp(info, envp);
+	execve(path, info->argv + 1, envp);
+	fprintf(stderr, "%s: %d: exec: %s: %s\n", info->fname, info->line_count,
+			info->argv[1], strerror(errno));
+	if (path != info->argv[1])
+		free(path);
+	return (126);
+}
+
+/**
+ * redir_file - Opens the file or descriptor a redirection names.
+ * @info: The parameter struct holding the shell variables.
+ * @op: The kind letter ('r', 'w', 'a', 'b' or 'd') and its operand.
+ *
+ * The operand is expanded first, without field splitting. A 'd' operand
+ * names a descriptor below REDIR_FDS or a coprocess pipe.
+ *
+ * Return: A new descriptor, -2 for a '-' operand of 'd', which closes
+ *         the redirected descriptor, or -1 after reporting a failure.
+ */
+int redir_file(info_t *info, char *op)
+{
+	static const int flags[] = {O_RDONLY, O_WRONLY | O_CREAT | O_TRUNC,
+		O_WRONLY | O_CREAT | O_APPEND, O_RDWR | O_CREAT};
+	static char kinds[] = "rwab";
+	char *name = expand_string(info, op + 1, strlen(op + 1)), *end;
+	long n;
+	int fd = -1;
+
+	if (!name)
+		return (-1);
+	errno = EBADF;
+	if (*op != 'd')
+		fd = open(name, flags[str_chr(kinds, *op) - kinds], 0666);
+	else if (!strcmp(name, "-"))
+		fd = -2;
+	else if (*name && (n = strtol(name, &end, 10)) >= 0 && !*end &&
+			(n < REDIR_FDS || coproc_owns(info, n)))
+		fd = dup(n);
+	if (fd == -1)
+		fprintf(stderr, "%s: %d: %s: %s\n", info->fname, info->line_count,
+				name, strerror(errno));
+	free(name);
+	return (fd);
+}
+
+/**
+ * redir_done - Ends the redirections of a command.
+ * @info: The parameter struct; exec sets info->keepfds to keep them.
+ * @saved: The descriptors saved by redir_apply().
+ */
+void redir_done(info_t *info, int *saved)
+{
+	if (info->keepfds)
+		redir_keep(info, saved);
+	else
+		redir_restore(saved);
+	info->keepfds = 0;
+}
+
+/**
+ * redir_keep - Makes the redirections of an exec line permanent.
+ * @info: The parameter struct holding the descriptor table.
+ * @saved: The descriptors saved by redir_apply(); they are closed.
+ *
+ * The descriptors are left without close-on-exec, so every later command
+ * inherits them, and info->fds records which of them are now open.
+ */
+void redir_keep(info_t *info, int *saved)
+{
+	int fd;
+
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	for (fd = 0; fd < REDIR_FDS; fd++)
+	{
+		if (saved[fd] == -2)
+			continue;
+		if (saved[fd] >= 0)
+			close(saved[fd]);
+		if (fcntl(fd, F_GETFD) == -1)
+			info->fds &= ~(1U << fd);
+		else
+			info->fds |= 1U << fd;
+	}
+}
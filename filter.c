@@ -0,0 +1,140 @@
+#include "myshell.h"
+
+/**
+ * filter_init - Prepares the input and output of a line filter builtin.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @f: The filter.
+ *
+ * Output the shell buffered so far is written first, since the filter
+ * writes to the descriptor directly.
+ */
+void filter_init(info_t *info, filter_t *f)
+{
+	strbuf_t none = {NULL, 0, 0};
+
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	f->info = info;
+	f->fd = -1;
+	f->name = "-";
+	f->in = none;
+	f->out = none;
+	f->pos = 0;
+	f->eof = f->failed = f->err = f->banners = 0;
+}
+
+/**
+ * filter_open - Opens the next input of a line filter.
+ * @f: The filter.
+ * @name: The file, or "-" for the standard input.
+ *
+ * Return: 0 on success, 1 after reporting a failure.
+ */
+int filter_open(filter_t *f, char *name)
+{
+	info_t *info = f->info;
+
+	f->name = name;
+	f->fd = strcmp(name, "-") ? open(name, O_RDONLY) : STDIN_FILENO;
+	f->in.len = f->pos = 0;
+	f->eof = 0;
+	if (f->fd != -1)
+		return (0);
+	fprintf(stderr, "%s: %d: %s: %s: %s\n", info->fname, info->line_count,
+			info->argv[0], name, strerror(errno));
+	f->failed = 1;
+	return (1);
+}
+
+/**
+ * filter_close - Closes the input of a line filter.
+ * @f: The filter.
+ *
+ * A filter that stops early, as head does, reads ahead of what it used;
+ * a seekable standard input is moved back to the first byte not used,
+ * so the next command reading it starts there.
+ */
+void filter_close(filter_t *f)
+{
+	if (f->fd == STDIN_FILENO && f->pos < f->in.len)
+		lseek(f->fd, -(off_t)(f->in.len - f->pos), SEEK_CUR);
+	else if (f->fd > STDIN_FILENO)
+		close(f->fd);
+	f->fd = -1;
+	f->in.len = f->pos = 0;
+}
+
+/**
+ * filter_fill - Reads more of the input of a line filter.
+ * @f: The filter.
+ *
+ * The bytes not used yet are moved to the start of the buffer and up to
+ * FILTER_BUF more are read after them, so a search with memchr() or
+ * memmem() goes over one large block at a time.
+ *
+ * Return: The number of bytes read, 0 at the end of the input, or -1
+ *         after reporting a failure.
+ */
+ssize_t filter_fill(filter_t *f)
+{
+	info_t *info = f->info;
+	ssize_t r;
+
+	if (f->eof)
+		return (0);
+	if (f->pos)
+	{
+		memmove(f->in.s, f->in.s + f->pos, f->in.len - f->pos);
+		f->in.len -= f->pos;
+		f->pos = 0;
+	}
+	if (sb_grow(&f->in, FILTER_BUF))
+		r = -1, errno = ENOMEM;
+	else
+		while ((r = read(f->fd, f->in.s + f->in.len,
+						f->in.cap - f->in.len - 1)) == -1 && errno == EINTR)
+			;
+	if (r <= 0)
+		f->eof = 1;
+	if (r > 0)
+		f->in.len += r;
+	else if (r == -1)
+	{
+		fprintf(stderr, "%s: %d: %s: %s: %s\n", info->fname, info->line_count,
+				info->argv[0], f->name, strerror(errno));
+		f->failed = 1;
+	}
+	return (r);
+}
+
+/**
+ * filter_line - Takes the next line of the input of a line filter.
+ * @f: The filter.
+ * @line: Receives the line, which stays valid until the next call.
+ * @len: Receives its length, counting the newline unless the input
+ *       ended without one.
+ *
+ * Return: 1 if a line was taken, 0 at the end of the input.
+ */
+int filter_line(filter_t *f, char **line, size_t *len)
+{
+	size_t from = f->pos;
+	char *nl;
+
+	for (;;)
+	{
+		nl = f->in.len > from ?
+			memchr(f->in.s + from, '\n', f->in.len - from) : NULL;
+		if (nl || (f->eof && f->pos < f->in.len))
+		{
+			*line = f->in.s + f->pos;
+			*len = nl ? (size_t)(nl + 1 - *line) : f->in.len - f->pos;
+			f->pos += *len;
+			return (1);
+		}
+		if (f->eof)
+			return (0);
+		from = f->in.len - f->pos; /* already searched, and moved to the start */
+		filter_fill(f);
+	}
+}
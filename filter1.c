@@ -0,0 +1,120 @@
+#include "myshell.h"
+
+/**
+ * filter_put - Writes output of a line filter.
+ * @f: The filter.
+ * @s: The bytes.
+ * @n: The number of bytes.
+ *
+ * The output is gathered into FILTER_BUF blocks before it is written.
+ *
+ * Return: 0 on success, -1 once writing failed.
+ */
+int filter_put(filter_t *f, const char *s, size_t n)
+{
+	if (f->err)
+		return (-1);
+	if (!n)
+		return (0);
+	if (sb_add(&f->out, s, n))
+	{
+		f->err = ENOMEM;
+		return (-1);
+	}
+	if (f->out.len >= FILTER_BUF)
+		return (filter_flush(f));
+	return (0);
+}
+
+/**
+ * filter_flush - Writes the output a line filter gathered.
+ * @f: The filter.
+ *
+ * A reader that quit early, as head does, is not reported.
+ *
+ * Return: 0 on success, -1 once writing failed.
+ */
+int filter_flush(filter_t *f)
+{
+	info_t *info = f->info;
+
+	if (!f->err && f->out.len && redir_write(STDOUT_FILENO, f->out.s, f->out.len))
+	{
+		f->err = errno;
+		if (errno != EPIPE)
+			fprintf(stderr, "%s: %d: %s: write error: %s\n", info->fname,
+					info->line_count, info->argv[0], strerror(errno));
+	}
+	f->out.len = 0;
+	return (f->err ? -1 : 0);
+}
+
+/**
+ * filter_end - Finishes a line filter builtin.
+ * @f: The filter; its output is written and its buffers freed.
+ * @ret: The status the filter ends with when writing worked.
+ *
+ * Return: @ret, or 1 if it is 0 and writing failed.
+ */
+int filter_end(filter_t *f, int ret)
+{
+	filter_close(f);
+	filter_flush(f);
+	free(f->in.s);
+	free(f->out.s);
+	f->in.s = f->out.s = NULL;
+	return (!ret && f->err ? 1 : ret);
+}
+
+/**
+ * filter_banner - Writes the heading of one of several files.
+ * @f: The filter.
+ * @name: The file, or "-" for the standard input.
+ *
+ * Headings after the first are set off by an empty line, as with head
+ * and tail.
+ */
+void filter_banner(filter_t *f, char *name)
+{
+	if (f->banners++)
+		filter_put(f, "\n", 1);
+	filter_put(f, "==> ", 4);
+	if (strcmp(name, "-"))
+		filter_put(f, name, strlen(name));
+	else
+		filter_put(f, "standard input", 14);
+	filter_put(f, " <==\n", 5);
+}
+
+/**
+ * filter_lines - Counts the newlines in a block.
+ * @s: The block.
+ * @n: Its length.
+ *
+ * The block is read a word at a time: every byte of a word that is a
+ * newline leaves a 1 in its lane, and the lanes are added up every 31
+ * words, before any of them can carry into the next.
+ *
+ * Return: The number of newlines.
+ */
+long filter_lines(const char *s, size_t n)
+{
+	unsigned long ones = ~0UL / 255, low = ones * 0x7f, w, sum;
+	size_t a = 0;
+	long lines = 0;
+	int k;
+
+	while (a + 31 * sizeof(w) <= n)
+	{
+		for (sum = 0, k = 0; k < 31; k++, a += sizeof(w))
+		{
+			memcpy(&w, s + a, sizeof(w));
+			w ^= ones * '\n';
+			sum += (~(((w & low) + low) | w) >> 7) & ones;
+		}
+		lines += (sum * ones) >> (sizeof(w) - 1) * CHAR_BIT;
+	}
+	for (; a < n; a++)
+		lines += s[a] == '\n';
+	return (lines);
+}
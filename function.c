@@ -0,0 +1,142 @@
+#include "myshell.h"
+
+/**
+ * func_find - Looks a function up by name.
+ * @info: The parameter struct holding the function table.
+ * @name: The function name.
+ *
+ * Return: The function, or NULL if none has that name.
+ */
+func_t *func_find(info_t *info, char *name)
+{
+	unsigned int hash;
+	func_t *f;
+
+	if (!info->funcs)
+		return (NULL);
+	hash = var_hash(name, strlen(name));
+	for (f = info->funcs[hash & (FUNC_BUCKETS - 1)]; f; f = f->next)
+		if (f->hash == hash && !strcmp(f->name, name))
+			return (f);
+	return (NULL);
+}
+
+/**
+ * func_define - Stores a function, replacing any of the same name.
+ * @info: The parameter struct holding the function table.
+ * @name: The function name.
+ * @body: The compiled body; the table takes a reference to it rather than
+ *        a copy, so defining a function costs no compiling or copying.
+ *
+ * Return: 0 on success, -1 if allocation fails.
+ */
+int func_define(info_t *info, char *name, prog_t *body)
+{
+	func_t *f = func_find(info, name);
+
+	if (!info->funcs)
+	{
+		info->funcs = malloc(sizeof(func_t *) * FUNC_BUCKETS);
+		if (!info->funcs)
+			return (-1);
+		memset(info->funcs, 0, sizeof(func_t *) * FUNC_BUCKETS);
+	}
+	if (!f)
+	{
+		f = malloc(sizeof(func_t));
+		if (!f)
+			return (-1);
+		f->name = dupStrn(name);
+		if (!f->name)
+			return (free(f), -1);
+		f->hash = var_hash(name, strlen(name));
+		f->next = info->funcs[f->hash & (FUNC_BUCKETS - 1)];
+		info->funcs[f->hash & (FUNC_BUCKETS - 1)] = f;
+	}
+	else
+		prog_free(f->body);
+	body->refs++;
+	f->body = body;
+	return (0);
+}
+
+/**
+ * func_unset - Removes a function.
+ * @info: The parameter struct holding the function table.
+ * @name: The function name.
+ *
+ * Return: 0 if a function was removed, -1 if none had that name.
+ */
+int func_unset(info_t *info, char *name)
+{
+	func_t **link, *f;
+	unsigned int hash = var_hash(name, strlen(name));
+
+	if (!info->funcs)
+		return (-1);
+	for (link = &info->funcs[hash & (FUNC_BUCKETS - 1)]; *link;
+			link = &(*link)->next)
+	{
+		f = *link;
+		if (f->hash != hash || strcmp(f->name, name))
+			continue;
+		*link = f->next;
+		prog_free(f->body);
+		free(f->name);
+		free(f);
+		return (0);
+	}
+	return (-1);
+}
+
+/**
+ * funcs_free - Frees the function table and every function in it.
+ * @info: The parameter struct holding the function table.
+ */
+void funcs_free(info_t *info)
+{
+	func_t *f, *next;
+	int a;
+
+	for (a = 0; info->funcs && a < FUNC_BUCKETS; a++)
+		for (f = info->funcs[a]; f; f = next)
+		{
+			next = f->next;
+			prog_free(f->body);
+			free(f->name);
+			free(f);
+		}
+	free(info->funcs);
+	info->funcs = NULL;
+}
+
+/**
+ * return_cmd - Returns from the running function.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: return [n]; without n the status of the last command is kept.
+ * A file run by 'source' may also return.
+ *
+ * Return: The function's exit status, or 2 on error.
+ */
+int return_cmd(info_t *info)
+{
+	int status = info->status;
+
+	if (!info->depth && !info->sourced)
+	{
+		printErro(info, "can only be used in a function");
+		return (2);
+	}
+	if (info->argv[1])
+	{
+		status = err_atoi(info->argv[1]);
+		if (status == -1)
+		{
+			printErro(info, "Illegal number");
+			return (2);
+		}
+	}
+	info->unwind |= UNWIND_RETURN;
+	return (status & 0xff);
+}
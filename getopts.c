@@ -0,0 +1,158 @@
+#include "myshell.h"
+
+/**
+ * getopts_cmd - Parses the next option of a command line.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: getopts optstring name [args...]
+ * The options are read from args, or from the positional parameters, at
+ * $OPTIND. Each call puts the next option letter in name and its
+ * argument in OPTARG, and moves OPTIND on; an unknown letter or missing
+ * argument gives '?' and a message, or, when optstring starts with ':',
+ * '?' or ':' with the letter in OPTARG and no message. The table built
+ * from optstring is kept for the next call of the same loop, as is the
+ * place within a group of options such as -abc.
+ *
+ * Return: 0 when an option was found, 1 at the end of the options, 2 on
+ *         a usage error.
+ */
+int getopts_cmd(info_t *info)
+{
+	char **args = info->argc > 3 ? info->argv + 3 : info->posv, *arg, *v;
+	int n = info->argc > 3 ? info->argc - 3 : info->posc;
+	getopts_t *g;
+	long optind;
+
+	if (info->argc < 3)
+		return (printErro(info, "usage: getopts optstring name [args...]"), 2);
+	if (!*info->argv[2] || info->argv[2][var_name_len(info->argv[2])])
+	{
+		fprintf(stderr, "%s: %d: getopts: %s: not a valid identifier\n",
+				info->fname, info->line_count, info->argv[2]);
+		return (1);
+	}
+	g = getopts_table(info, info->argv[1]);
+	if (!g)
+		return (1);
+	v = var_value(info, "OPTIND", 6);
+	optind = v && *v ? strtol(v, NULL, 10) : 1;
+	if (optind != g->optind || optind < 1)
+		g->pos = 0;
+	g->optind = optind < 1 ? 1 : optind;
+	arg = g->optind <= n ? args[g->optind - 1] : NULL;
+	if (!g->pos && (!arg || arg[0] != '-' || !arg[1] || !strcmp(arg, "--")))
+	{
+		g->optind += arg && !strcmp(arg, "--");
+		getopts_set(info, g, '?', NULL);
+		return (1);
+	}
+	getopts_next(info, g, args, n);
+	return (0);
+}
+
+/**
+ * getopts_table - Gets the option table of an optstring.
+ * @info: The parameter struct holding the table of the last call.
+ * @optstring: The optstring.
+ *
+ * The table is only built again when the optstring changes, which also
+ * starts over within a group of options.
+ *
+ * Return: The table, or NULL if allocation fails.
+ */
+getopts_t *getopts_table(info_t *info, char *optstring)
+{
+	getopts_t *g = info->getopts;
+	char *s;
+
+	if (g && !strcmp(g->optstring, optstring))
+		return (g);
+	if (!g)
+	{
+		g = malloc(sizeof(getopts_t));
+		if (!g)
+			return (NULL);
+		g->optstring = NULL;
+		info->getopts = g;
+	}
+	free(g->optstring);
+	g->optstring = dupStrn(optstring);
+	if (!g->optstring)
+		return (getopts_free(info), NULL);
+	memset(g->kinds, 0, sizeof(g->kinds));
+	for (s = optstring + (*optstring == ':'); *s; s++)
+		if (*s != ':' && *s != '?')
+			g->kinds[(unsigned char)*s] = s[1] == ':' ? 2 : 1;
+	g->optind = 0, g->pos = 0;
+	return (g);
+}
+
+/**
+ * getopts_next - Takes the option at OPTIND and its argument.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @g: The table, with g->optind on an argument holding an option.
+ * @args: The arguments parsed.
+ * @n: The number of @args.
+ */
+void getopts_next(info_t *info, getopts_t *g, char **args, int n)
+{
+	char *arg = args[g->optind - 1], c = arg[g->pos ? g->pos : 1];
+	char *optarg = NULL, *msg = NULL, letter[2] = {'\0', '\0'};
+	int silent = *info->argv[1] == ':', kind = g->kinds[(unsigned char)c];
+
+	g->pos = g->pos ? g->pos + 1 : 2;
+	if (kind == 2 && arg[g->pos])
+		optarg = arg + g->pos, g->optind++;
+	else if (kind == 2 && g->optind < n)
+		optarg = args[g->optind], g->optind += 2;
+	else if (kind == 2)
+		msg = "option requires an argument", g->optind++;
+	else if (!arg[g->pos])
+		g->optind++;
+	if (kind == 2 || !arg[g->pos])
+		g->pos = 0;
+	letter[0] = c;
+	if (!kind)
+		msg = "illegal option";
+	if (msg && !silent && !(var_value(info, "OPTERR", 6) &&
+				!strcmp(var_value(info, "OPTERR", 6), "0")))
+		fprintf(stderr, "%s: %d: %s: %s -- %c\n", info->fname,
+				info->line_count, info->argv[0], msg, c);
+	if (!msg)
+		getopts_set(info, g, c, optarg);
+	else
+		getopts_set(info, g, silent && kind ? ':' : '?', silent ? letter : NULL);
+}
+
+/**
+ * getopts_set - Sets the variables a getopts call leaves.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @g: The table, holding the new OPTIND.
+ * @c: The value of the name variable.
+ * @optarg: The value of OPTARG, or NULL to unset it.
+ */
+void getopts_set(info_t *info, getopts_t *g, char c, char *optarg)
+{
+	char one[2];
+
+	one[0] = c, one[1] = '\0';
+	var_set(info, info->argv[2], lenstrn(info->argv[2]), one, 0);
+	var_set(info, "OPTIND", 6, number_to_strn(g->optind, 10, 0), 0);
+	if (optarg)
+		var_set(info, "OPTARG", 6, optarg, 0);
+	else
+		var_unset(info, "OPTARG", 6);
+}
+
+/**
+ * getopts_free - Frees the option table getopts keeps.
+ * @info: The parameter struct holding it.
+ */
+void getopts_free(info_t *info)
+{
+	if (!info->getopts)
+		return;
+	free(info->getopts->optstring);
+	free(info->getopts);
+	info->getopts = NULL;
+}
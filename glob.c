@@ -0,0 +1,175 @@
+#include "myshell.h"
+
+/**
+ * glob_word - Expands a pattern to the file names it matches.
+ * @info: The parameter struct holding the directory listings.
+ * @pattern: The pattern, quoted characters escaped; ownership passes to
+ *           this function.
+ * @out: Receives the sorted matches, or the pattern itself with its
+ *       escapes removed if nothing matches.
+ *
+ * Return: The number of words pushed onto @out.
+ */
+size_t glob_word(info_t *info, char *pattern, wordlist_t *out)
+{
+	strbuf_t path = {NULL, 0, 0};
+	size_t before = out->n;
+
+	if (glob_has_meta(pattern))
+	{
+		if (*pattern == '/')
+			sb_addc(&path, '/');
+		glob_walk(info, &path, pattern + (*pattern == '/'), out);
+		free(path.s);
+	}
+	if (out->n > before)
+		free(pattern);
+	else
+	{
+		glob_unescape(pattern);
+		wl_push(out, pattern);
+	}
+	return (out->n - before);
+}
+
+/**
+ * glob_walk - Matches the remaining components of a pattern.
+ * @info: The parameter struct holding the directory listings.
+ * @path: The directory matched so far, ending in '/' unless empty; it is
+ *        restored before returning.
+ * @pat: The components left to match.
+ * @out: Receives the matches.
+ *
+ * Only components holding pattern characters read a directory, and they
+ * are compiled once for all its entries. A hidden entry only matches a
+ * component that starts with a '.'. A ** component is handed to
+ * glob_tree().
+ */
+void glob_walk(info_t *info, strbuf_t *path, char *pat, wordlist_t *out)
+{
+	size_t a, len = path->len, comp = strcspn(pat, "/");
+	char *seg = malloc(comp + 1), *name;
+	globdir_t *d = NULL;
+	pattern_t *p = NULL;
+	struct stat st;
+
+	if (!seg)
+		return;
+	memcpy(seg, pat, comp);
+	seg[comp] = '\0';
+	if (!strcmp(seg, "**"))
+	{
+		free(seg);
+		glob_tree(info, path, pat[comp] ? pat + comp + 1 : NULL, out);
+		return;
+	}
+	if (glob_has_meta(seg) && (!(p = pattern_compile(seg, 0)) ||
+				!(d = glob_dir(info, path->len ? path->s : "."))))
+	{
+		pattern_free(p);
+		free(seg);
+		return;
+	}
+	if (!d)
+		glob_unescape(seg);
+	for (a = 0; !d || a < d->n; a++)
+	{
+		name = d ? d->names[a] : seg;
+		if (d && (*name == '.' ? *seg != '.' : 0))
+			continue;
+		if (d && pattern_span(p, name, strlen(name), 1) != (long)strlen(name))
+			continue;
+		path->len = len;
+		sb_add(path, name, strlen(name));
+		if (pat[comp])
+		{
+			sb_addc(path, '/');
+			glob_walk(info, path, pat + comp + 1, out);
+		}
+		else if (d || !lstat(path->s, &st))
+			wl_push(out, dupStrn(path->s));
+		if (!d)
+			break;
+	}
+	if (path->s)
+		path->s[path->len = len] = '\0';
+	pattern_free(p);
+	free(seg);
+}
+
+/**
+ * glob_dir - Lists a directory, or reuses the listing made for an earlier
+ *            pattern of the same command.
+ * @info: The parameter struct holding the directory listings.
+ * @dir: The directory.
+ *
+ * All names go into one buffer, so a listing costs a few allocations
+ * however large the directory is.
+ *
+ * Return: The listing (empty if the directory cannot be read), or NULL
+ *         if allocation fails.
+ */
+globdir_t *glob_dir(info_t *info, char *dir)
+{
+	strbuf_t buf = {NULL, 0, 0};
+	globdir_t *d;
+	struct dirent *e;
+	DIR *dp;
+	size_t a, off;
+
+	for (d = info->globdirs; d; d = d->next)
+		if (!strcmp(d->path, dir))
+			return (d);
+	d = malloc(sizeof(globdir_t));
+	if (!d)
+		return (NULL);
+	memset(d, 0, sizeof(globdir_t));
+	d->path = dupStrn(dir);
+	d->next = info->globdirs;
+	info->globdirs = d;
+	dp = opendir(dir);
+	while (dp && (e = readdir(dp)))
+		if (strcmp(e->d_name, ".") && strcmp(e->d_name, ".."))
+			sb_add(&buf, e->d_name, strlen(e->d_name) + 1), d->n++;
+	if (dp)
+		closedir(dp);
+	d->buf = buf.s;
+	d->names = malloc(sizeof(char *) * (d->n + 1));
+	if (!d->names || !d->path || (d->n && !d->buf))
+		return (d->n = 0, NULL);
+	for (a = off = 0; a < d->n; a++, off += strlen(d->buf + off) + 1)
+		d->names[a] = d->buf + off;
+	qsort(d->names, d->n, sizeof(char *), glob_cmp);
+	return (d);
+}
+
+/**
+ * glob_cmp - Orders two file names for qsort().
+ * @a: Pointer to the first name.
+ * @b: Pointer to the second name.
+ *
+ * Return: Less than, equal to or greater than 0, like strcmp().
+ */
+int glob_cmp(const void *a, const void *b)
+{
+	return (strcmp(*(char * const *)a, *(char * const *)b));
+}
+
+/**
+ * globdirs_free - Frees the directory listings made for a command.
+ * @info: The parameter struct holding them.
+ */
+void globdirs_free(info_t *info)
+{
+	globdir_t *d, *next;
+
+	for (d = info->globdirs; d; d = next)
+	{
+		next = d->next;
+		free(d->path);
+		free(d->names);
+		free(d->buf);
+		free(d);
+	}
+	info->globdirs = NULL;
+}
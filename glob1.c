@@ -0,0 +1,98 @@
+#include "myshell.h"
+
+/**
+ * glob_fields - Brace-expands a raw word, then expands and globs each
+ *               resulting word.
+ * @info: The parameter struct holding the shell variables.
+ * @word: The word as written, quotes included.
+ * @out: Receives the resulting words.
+ *
+ * A brace expansion making more than BRACE_MAX words could not be passed
+ * to a program anyway, so it is reported and the word left as it is.
+ *
+ * Return: The number of words pushed onto @out.
+ */
+size_t glob_fields(info_t *info, char *word, wordlist_t *out)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	size_t before = out->n;
+	unsigned long a, n;
+	int groups = 0;
+	brace_t *b = strchr(word, '{') ?
+		brace_parse(word, strlen(word), &groups) : NULL;
+
+	n = groups > 0 ? brace_total(b) : 0;
+	if (n > BRACE_MAX)
+		fprintf(stderr, "%s: %d: %s: brace expansion too large\n",
+				info->fname, info->line_count, word);
+	if (!n || n > BRACE_MAX)
+		glob_expand(info, word, out);
+	for (a = 0; n <= BRACE_MAX && a < n; a++)
+	{
+		sb.len = 0;
+		brace_nth(b, a, &sb);
+		if (sb.len) /* an empty word is no field */
+			glob_expand(info, sb.s, out);
+	}
+	free(sb.s);
+	brace_free(b);
+	return (out->n - before);
+}
+
+/**
+ * glob_expand - Expands a raw word into fields and globs each of them.
+ * @info: The parameter struct holding the shell variables.
+ * @word: The word as written, quotes included.
+ * @out: Receives the resulting words.
+ *
+ * Return: The number of words pushed onto @out.
+ */
+size_t glob_expand(info_t *info, char *word, wordlist_t *out)
+{
+	wordlist_t fields = {NULL, 0, 0, 1};
+	size_t a, before = out->n;
+
+	expand_word(info, word, &fields, 1);
+	for (a = 0; a < fields.n; a++)
+		glob_word(info, fields.v[a], out);
+	free(fields.v);
+	return (out->n - before);
+}
+
+/**
+ * glob_has_meta - Checks whether a pattern has unescaped * ? or [...].
+ * @p: The pattern.
+ *
+ * A '[' with no ']' after it is an ordinary character, so the test
+ * command '[' is not globbed.
+ *
+ * Return: 1 if globbing the pattern could match other names, 0 otherwise.
+ */
+int glob_has_meta(const char *p)
+{
+	for (; *p; p++)
+	{
+		if (*p == '\\' && p[1])
+			p++;
+		else if (*p == '*' || *p == '?' || (*p == '[' && strchr(p + 1, ']')))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * glob_unescape - Removes the backslash escapes from a pattern in place.
+ * @s: The pattern.
+ */
+void glob_unescape(char *s)
+{
+	char *d = s;
+
+	for (; *s; s++)
+	{
+		if (*s == '\\' && s[1])
+			s++;
+		*d++ = *s;
+	}
+	*d = '\0';
+}
@@ -0,0 +1,119 @@
+#include "myshell.h"
+
+/**
+ * glob_tree - Matches a ** component: any number of directories.
+ * @info: The parameter struct holding the shell variables.
+ * @path: The directory matched so far, ending in '/' unless empty; it is
+ *        restored before returning.
+ * @rest: The components after the **, or NULL if it was the last one.
+ * @out: Receives the sorted matches.
+ *
+ * The tree is walked by several threads at once (see glob_threads()).
+ * When a single component follows, the threads match it as they go;
+ * otherwise they collect the directories and the remaining components
+ * are matched in each of them afterwards. Hidden directories are not
+ * entered.
+ */
+void glob_tree(info_t *info, strbuf_t *path, char *rest, wordlist_t *out)
+{
+	wordlist_t all = {NULL, 0, 0, 0}, res = {NULL, 0, 0, 0};
+	size_t a, len = path->len;
+	int w, fd = open(len ? path->s : ".", O_RDONLY | O_DIRECTORY);
+	globtree_t t;
+
+	memset(&t, 0, sizeof(t));
+	if (!rest || (*rest && !str_chr(rest, '/')))
+		t.last = pattern_compile(rest ? rest : "*", 0);
+	if (fd == -1 || (!t.last && (!rest || (*rest && !str_chr(rest, '/')))))
+	{
+		if (fd != -1)
+			close(fd);
+		return;
+	}
+	glob_spawn(&t, glob_threads(info), fd, len ? path->s : "");
+	for (w = 0; w < t.nworkers; w++)
+	{
+		for (a = 0; a < t.workers[w].found.n; a++)
+			wl_push(t.last ? &res : &all, t.workers[w].found.v[a]);
+		free(t.workers[w].found.v);
+	}
+	free(t.workers);
+	qsort(all.v, all.n, sizeof(char *), glob_cmp);
+	if (!t.last)
+		glob_walk(info, path, rest, &res);
+	for (a = 0; a < all.n; a++) /* then in every directory below */
+	{
+		path->len = 0;
+		sb_add(path, all.v[a], strlen(all.v[a]));
+		glob_walk(info, path, rest, &res);
+		path->s[path->len = len] = '\0';
+	}
+	free_strn(all.v);
+	qsort(res.v, res.n, sizeof(char *), glob_cmp);
+	for (a = 0; a < res.n; a++)
+		wl_push(out, res.v[a]);
+	free(res.v);
+	pattern_free(t.last);
+}
+
+/**
+ * glob_threads - Gets the number of threads walking a ** tree.
+ * @info: The parameter struct holding the shell variables.
+ *
+ * HSH_GLOB_THREADS caps it; by default there is one per online CPU.
+ *
+ * Return: A number from 1 to GLOB_MAX_THREADS.
+ */
+int glob_threads(info_t *info)
+{
+	char *v = var_value(info, "HSH_GLOB_THREADS", 16);
+	long n = v && *v ? strtol(v, NULL, 10) : sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (n < 1)
+		return (1);
+	return (n > GLOB_MAX_THREADS ? GLOB_MAX_THREADS : n);
+}
+
+/**
+ * glob_spawn - Runs the workers of a ** walk until the tree is read.
+ * @t: The walk; its workers and their results are left for the caller.
+ * @n: The number of workers; the calling thread is the first one.
+ * @fd: The base directory, which becomes the first task.
+ * @base: The name of the base directory as results show it.
+ */
+void glob_spawn(globtree_t *t, int n, int fd, char *base)
+{
+	pthread_t tids[GLOB_MAX_THREADS];
+	int a, started;
+
+	t->workers = malloc(sizeof(globworker_t) * n);
+	if (!t->workers)
+	{
+		close(fd);
+		return;
+	}
+	memset(t->workers, 0, sizeof(globworker_t) * n);
+	t->nworkers = n;
+	pthread_mutex_init(&t->lock, NULL);
+	pthread_cond_init(&t->idle, NULL);
+	for (a = 0; a < n; a++)
+	{
+		pthread_mutex_init(&t->workers[a].lock, NULL);
+		t->workers[a].tree = t;
+	}
+	glob_push(&t->workers[0], fd, dupStrn(base));
+	for (started = 1; started < n; started++)
+		if (pthread_create(&tids[started], NULL, glob_worker,
+					&t->workers[started]))
+			break;
+	glob_worker(&t->workers[0]);
+	for (a = 1; a < started; a++)
+		pthread_join(tids[a], NULL);
+	for (a = 0; a < n; a++)
+	{
+		pthread_mutex_destroy(&t->workers[a].lock);
+		free(t->workers[a].tasks);
+	}
+	pthread_cond_destroy(&t->idle);
+	pthread_mutex_destroy(&t->lock);
+}
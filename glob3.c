@@ -0,0 +1,192 @@
+#include "myshell.h"
+
+/**
+ * glob_worker - Runs the tasks of a ** walk until none are left.
+ * @arg: The worker.
+ *
+ * Return: NULL.
+ */
+void *glob_worker(void *arg)
+{
+	globworker_t *w = arg;
+	globtree_t *t = w->tree;
+	globtask_t task;
+
+	while (glob_take(w, &task))
+	{
+		glob_visit(w, task.fd, task.path);
+		free(task.path);
+		pthread_mutex_lock(&t->lock);
+		t->open--;
+		if (!--t->pending)
+			pthread_cond_broadcast(&t->idle);
+		pthread_mutex_unlock(&t->lock);
+	}
+	return (NULL);
+}
+
+/**
+ * glob_take - Gets the next task for a worker.
+ * @w: The worker.
+ * @task: Receives the task.
+ *
+ * A worker takes the newest task of its own queue, so it goes deep first
+ * and keeps few directories open; when that is empty it steals the oldest
+ * task of another worker, which is likely the root of a large subtree.
+ *
+ * Return: 1 if a task was taken, 0 once the whole tree has been read.
+ */
+int glob_take(globworker_t *w, globtask_t *task)
+{
+	globtree_t *t = w->tree;
+	globworker_t *v;
+	long seen, pending;
+	int a;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&t->lock);
+		seen = t->queued;
+		pthread_mutex_unlock(&t->lock);
+		for (a = 0; a < t->nworkers; a++)
+		{
+			v = &t->workers[(w - t->workers + a) % t->nworkers];
+			pthread_mutex_lock(&v->lock);
+			if (v->head < v->n)
+			{
+				*task = v == w ? v->tasks[--v->n] : v->tasks[v->head++];
+				pthread_mutex_unlock(&v->lock);
+				return (1);
+			}
+			pthread_mutex_unlock(&v->lock);
+		}
+		pthread_mutex_lock(&t->lock);
+		while (t->pending && t->queued == seen)
+			pthread_cond_wait(&t->idle, &t->lock);
+		pending = t->pending;
+		pthread_mutex_unlock(&t->lock);
+		if (!pending)
+			return (0);
+	}
+}
+
+/**
+ * glob_push - Queues a directory for a worker of a ** walk.
+ * @w: The worker whose queue gets it.
+ * @fd: The open directory; ownership passes to this function.
+ * @path: Its name as results show it, ending in '/' unless empty;
+ *        ownership passes to this function.
+ *
+ * If the queue cannot grow the directory is read straight away.
+ */
+void glob_push(globworker_t *w, int fd, char *path)
+{
+	globtree_t *t = w->tree;
+	globtask_t *tasks;
+	size_t cap;
+
+	pthread_mutex_lock(&w->lock);
+	if (w->n == w->cap && w->head) /* reuse the slots stolen from the front */
+	{
+		memmove(w->tasks, w->tasks + w->head, sizeof(globtask_t) * (w->n - w->head));
+		w->n -= w->head, w->head = 0;
+	}
+	if (w->n == w->cap && (tasks = realloc(w->tasks,
+					sizeof(globtask_t) * (cap = w->cap ? w->cap * 2 : 16))))
+		w->tasks = tasks, w->cap = cap;
+	if (!path || w->n == w->cap)
+	{
+		pthread_mutex_unlock(&w->lock);
+		if (path)
+			glob_visit(w, fd, path);
+		else
+			close(fd);
+		free(path);
+		return;
+	}
+	pthread_mutex_lock(&t->lock); /* counted before anyone can finish it */
+	t->pending++, t->open++;
+	pthread_mutex_unlock(&t->lock);
+	w->tasks[w->n].fd = fd;
+	w->tasks[w->n++].path = path;
+	pthread_mutex_unlock(&w->lock);
+	pthread_mutex_lock(&t->lock);
+	t->queued++;
+	pthread_cond_broadcast(&t->idle);
+	pthread_mutex_unlock(&t->lock);
+}
+
+/**
+ * glob_visit - Reads one directory of a ** walk.
+ * @w: The worker reading it; matches go to its results.
+ * @fd: The open directory; it is closed before returning.
+ * @path: Its name as results show it, ending in '/' unless empty.
+ *
+ * Subdirectories are opened relative to @fd, so no path is looked up
+ * twice. They are queued while fewer than GLOB_MAX_OPEN are waiting, and
+ * read straight away beyond that.
+ */
+void glob_visit(globworker_t *w, int fd, char *path)
+{
+	globtree_t *t = w->tree;
+	strbuf_t sb = {NULL, 0, 0};
+	DIR *dp = fdopendir(fd);
+	struct dirent *e;
+	size_t len = strlen(path), n;
+	long open;
+	int sub;
+
+	if (!dp)
+	{
+		close(fd);
+		return;
+	}
+	sb_add(&sb, path, len);
+	while (sb.s && (e = readdir(dp)))
+	{
+		n = strlen(e->d_name);
+		if (!strcmp(e->d_name, ".") || !strcmp(e->d_name, ".."))
+			continue;
+		sb.s[sb.len = len] = '\0';
+		sb_add(&sb, e->d_name, n);
+		if (t->last && (*e->d_name != '.' || *t->last->text == '.') &&
+				pattern_span(t->last, e->d_name, n, 1) == (long)n)
+			wl_push(&w->found, dupStrn(sb.s));
+		if (*e->d_name == '.' || !glob_isdir(dirfd(dp), e))
+			continue;
+		sb_addc(&sb, '/');
+		if (!t->last)
+			wl_push(&w->found, dupStrn(sb.s));
+		sub = openat(dirfd(dp), e->d_name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+		if (sub == -1)
+			continue;
+		pthread_mutex_lock(&t->lock);
+		open = t->open;
+		pthread_mutex_unlock(&t->lock);
+		if (open < GLOB_MAX_OPEN)
+			glob_push(w, sub, dupStrn(sb.s));
+		else
+			glob_visit(w, sub, sb.s);
+	}
+	closedir(dp);
+	free(sb.s);
+}
+
+/**
+ * glob_isdir - Checks whether a directory entry is a directory.
+ * @dfd: The directory holding it.
+ * @e: The entry.
+ *
+ * Symbolic links are not followed, so a ** walk cannot loop.
+ *
+ * Return: 1 if it is a directory, 0 otherwise.
+ */
+int glob_isdir(int dfd, struct dirent *e)
+{
+	struct stat st;
+
+	if (e->d_type != DT_UNKNOWN)
+		return (e->d_type == DT_DIR);
+	return (!fstatat(dfd, e->d_name, &st, AT_SYMLINK_NOFOLLOW) &&
+			S_ISDIR(st.st_mode));
+}
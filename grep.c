@@ -0,0 +1,203 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+
+/**
+ * grep_cmd - Writes the lines of a file that match a pattern.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: grep [-cnqvEF] [-e] pattern [file]
+ * With no file, or for a '-', the standard input is read. A pattern with
+ * no special characters is searched for as a string with memmem() over
+ * whole blocks of input instead of line by line; any other is compiled
+ * once with regcomp(). Other options, or several files, hand the command
+ * over to the grep program.
+ *
+ * Return: 0 if a line was selected, 1 if none was, 2 if the file could
+ *         not be read, or -1 to run the grep program instead.
+ */
+int grep_cmd(info_t *info)
+{
+	grep_t g;
+	filter_t f;
+	int a = grep_opts(info, &g);
+	char *n;
+
+	if (a < 0)
+		return (-1);
+	filter_init(info, &f);
+	if (!filter_open(&f, info->argv[a] ? info->argv[a] : "-"))
+	{
+		grep_file(&f, &g);
+		filter_close(&f);
+	}
+	if (g.count && !g.quiet)
+	{
+		n = number_to_strn(g.matches, 10, 0);
+		filter_put(&f, n, strlen(n));
+		filter_put(&f, "\n", 1);
+	}
+	if (!g.fixed)
+		regfree(&g.re);
+	return (filter_end(&f, g.quiet && g.matches ? 0 :
+				f.failed ? 2 : !g.matches));
+}
+
+/**
+ * grep_opts - Parses the options and pattern of a grep command.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @g: Receives the options and the pattern, compiled unless it is fixed.
+ *
+ * Return: The index of the file, or -1 for what this shell leaves to the
+ *         program: other options, several files, a pattern with more
+ *         than one line or one regcomp() refuses.
+ */
+int grep_opts(info_t *info, grep_t *g)
+{
+	char **argv = info->argv, *o;
+	int a, ext = 0, fixed = 0;
+
+	memset(g, 0, sizeof(*g));
+	for (a = 1; argv[a] && argv[a][0] == '-' && argv[a][1] && !g->pat; a++)
+	{
+		if (!strcmp(argv[a], "--"))
+		{
+			a++;
+			break;
+		}
+		for (o = argv[a] + 1; *o && !g->pat; o++)
+			if (*o == 'e' && !(g->pat = o[1] ? o + 1 : argv[++a]))
+				return (-1);
+			else if (*o == 'c')
+				g->count = 1;
+			else if (*o == 'n')
+				g->number = 1;
+			else if (*o == 'q')
+				g->quiet = 1;
+			else if (*o == 'v')
+				g->invert = 1;
+			else if (*o == 'E')
+				ext = 1;
+			else if (*o == 'F')
+				fixed = 1;
+			else if (*o != 'e')
+				return (-1);
+	}
+	if (!g->pat && !(g->pat = argv[a++]))
+		return (-1);
+	if ((argv[a] && (argv[a + 1] || (argv[a][0] == '-' && argv[a][1]))) ||
+			str_chr(g->pat, '\n'))
+		return (-1);
+	g->len = strlen(g->pat);
+	g->fixed = fixed ||
+		!g->pat[strcspn(g->pat, ext ? "\\.[*^$+?(){}|" : "\\.[*^$")];
+	if (!g->fixed && regcomp(&g->re, g->pat,
+				REG_NOSUB | (ext ? REG_EXTENDED : 0)))
+		return (-1);
+	return (a);
+}
+
+/**
+ * grep_file - Selects the lines of the input of a grep command.
+ * @f: The filter reading the input.
+ * @g: The pattern and options.
+ *
+ * Lines are matched in place, regexec() bounded by REG_STARTEND instead
+ * of a copy of each line.
+ */
+void grep_file(filter_t *f, grep_t *g)
+{
+	regmatch_t m;
+	char *line;
+	size_t len, n;
+	int hit;
+
+	if (g->fixed && !g->invert)
+	{
+		grep_fixed(f, g);
+		return;
+	}
+	while (!f->err && !(g->quiet && g->matches) && filter_line(f, &line, &len))
+	{
+		n = len - (line[len - 1] == '\n');
+		g->lineno++;
+		if (g->fixed)
+			hit = memmem(line, n, g->pat, g->len) != NULL;
+		else
+		{
+			m.rm_so = 0, m.rm_eo = n;
+			hit = !regexec(&g->re, line, 1, &m, REG_STARTEND);
+		}
+		if (hit != g->invert)
+			grep_select(f, g, line, len);
+	}
+}
+
+/**
+ * grep_fixed - Selects the lines of the input holding a fixed string.
+ * @f: The filter reading the input.
+ * @g: The pattern and options.
+ *
+ * memmem() runs over every complete line in the buffer at once; only
+ * the line around each match is looked for, with memrchr() and memchr(),
+ * so lines that do not match are never split apart.
+ */
+void grep_fixed(filter_t *f, grep_t *g)
+{
+	char *s, *hit, *line, *nl;
+	size_t end;
+
+	while (!f->err && !(g->quiet && g->matches))
+	{
+		s = f->in.s;
+		nl = f->in.len > f->pos ?
+			memrchr(s + f->pos, '\n', f->in.len - f->pos) : NULL;
+		if (!nl && !f->eof)
+		{
+			filter_fill(f);
+			continue;
+		}
+		if (!nl && f->pos == f->in.len)
+			break;
+		end = nl ? (size_t)(nl + 1 - s) : f->in.len;
+		while (f->pos < end && !(g->quiet && g->matches) &&
+				(hit = memmem(s + f->pos, end - f->pos, g->pat, g->len)))
+		{
+			line = memrchr(s + f->pos, '\n', hit - (s + f->pos));
+			line = line ? line + 1 : s + f->pos;
+			if (g->number)
+				g->lineno += filter_lines(s + f->pos, line - (s + f->pos)) + 1;
+			nl = memchr(hit, '\n', s + end - hit);
+			f->pos = nl ? (size_t)(nl + 1 - s) : end;
+			grep_select(f, g, line, s + f->pos - line);
+		}
+		if (g->number && !(g->quiet && g->matches))
+			g->lineno += filter_lines(s + f->pos, end - f->pos);
+		if (!(g->quiet && g->matches))
+			f->pos = end;
+	}
+}
+
+/**
+ * grep_select - Takes a line a grep command selected.
+ * @f: The filter.
+ * @g: The options; the line is counted in g->matches.
+ * @line: The line.
+ * @len: Its length, counting its newline if it has one.
+ */
+void grep_select(filter_t *f, grep_t *g, char *line, size_t len)
+{
+	char *n;
+
+	g->matches++;
+	if (g->quiet || g->count)
+		return;
+	if (g->number)
+	{
+		n = number_to_strn(g->lineno, 10, 0);
+		filter_put(f, n, strlen(n));
+		filter_put(f, ":", 1);
+	}
+	filter_put(f, line, len);
+	if (line[len - 1] != '\n')
+		filter_put(f, "\n", 1);
+}
@@ -0,0 +1,183 @@
+#include "myshell.h"
+
+/**
+ * head_cmd - Writes the first lines of files.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: head [-n count | -c count | -count] [file...]
+ * With no file, or for a '-', the standard input is read. It runs in the
+ * shell, so 'history | head' forks nothing (see pipe_inproc()); other
+ * options hand the command over to the head program.
+ *
+ * Return: 0 on success, 1 if a file could not be read, or -1 to run
+ *         the head program instead.
+ */
+int head_cmd(info_t *info)
+{
+	filter_t f;
+	long n;
+	int bytes, a = head_opts(info, &n, &bytes, NULL), k;
+	char *name;
+
+	if (a < 0)
+		return (-1);
+	filter_init(info, &f);
+	for (k = a; k == a || k < info->argc; k++)
+	{
+		name = k < info->argc ? info->argv[k] : "-";
+		if (filter_open(&f, name))
+			continue;
+		if (info->argc - a > 1)
+			filter_banner(&f, name);
+		head_file(&f, n, bytes, 1);
+		filter_close(&f);
+	}
+	return (filter_end(&f, f.failed));
+}
+
+/**
+ * head_opts - Parses the options of a head or tail command.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @n: Receives the count, 10 by default.
+ * @bytes: Receives 1 if the count is of bytes (-c), 0 if of lines.
+ * @from: Receives 1 for a '+count' of tail, which counts from the start;
+ *        NULL for head, where a '+' changes nothing.
+ *
+ * Return: The index of the first file, or -1 for an option this shell
+ *         leaves to the program.
+ */
+int head_opts(info_t *info, long *n, int *bytes, int *from)
+{
+	char **argv = info->argv, *v, *end;
+	int a;
+
+	*n = 10, *bytes = 0;
+	if (from)
+		*from = 0;
+	for (a = 1; argv[a] && argv[a][0] == '-' && argv[a][1]; a++)
+	{
+		if (!strcmp(argv[a], "--"))
+			return (a + 1);
+		v = argv[a] + 1;
+		if (*v == 'n' || *v == 'c')
+		{
+			*bytes = *v == 'c';
+			v = v[1] ? v + 1 : argv[++a];
+		}
+		if (!v)
+			return (-1);
+		if (*v == '+' && from)
+			*from = 1;
+		if (*v == '+' || (*v == '-' && from))
+			v++;
+		*n = strtol(v, &end, 10);
+		if (*v < '0' || *v > '9' || *end)
+			return (-1);
+	}
+	return (a);
+}
+
+/**
+ * head_file - Copies the first lines of the input of a filter.
+ * @f: The filter.
+ * @n: The number of lines, or of bytes.
+ * @bytes: Set if @n counts bytes.
+ * @put: Set to write them, clear to skip them as 'tail +count' does.
+ *
+ * Whole blocks are written at once, their lines counted with memchr().
+ */
+void head_file(filter_t *f, long n, int bytes, int put)
+{
+	char *p, *nl;
+	size_t len, k;
+
+	while (n > 0 && !f->err && (f->pos < f->in.len || filter_fill(f) > 0))
+	{
+		p = f->in.s + f->pos;
+		len = f->in.len - f->pos;
+		if (bytes)
+			k = (size_t)n < len ? (size_t)n : len, n -= k;
+		else
+			for (k = 0; n > 0 && k < len; n--)
+			{
+				nl = memchr(p + k, '\n', len - k);
+				if (!nl)
+				{
+					k = len;
+					break;
+				}
+				k = nl + 1 - p;
+			}
+		if (put)
+			filter_put(f, p, k);
+		f->pos += k;
+	}
+}
+
+/**
+ * tail_cmd - Writes the last lines of files.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: tail [-n [+]count | -c [+]count | -count] [file...]
+ * With no file, or for a '-', the standard input is read. A regular file
+ * is read backwards from its end, so only the lines written are read;
+ * a '+count' starts at that line or byte instead. Other options hand the
+ * command over to the tail program.
+ *
+ * Return: 0 on success, 1 if a file could not be read, or -1 to run
+ *         the tail program instead.
+ */
+int tail_cmd(info_t *info)
+{
+	filter_t f;
+	long n;
+	int bytes, from, a = head_opts(info, &n, &bytes, &from), k;
+	char *name;
+
+	if (a < 0)
+		return (-1);
+	filter_init(info, &f);
+	for (k = a; k == a || k < info->argc; k++)
+	{
+		name = k < info->argc ? info->argv[k] : "-";
+		if (filter_open(&f, name))
+			continue;
+		if (info->argc - a > 1)
+			filter_banner(&f, name);
+		tail_file(&f, n, bytes, from);
+		filter_close(&f);
+	}
+	return (filter_end(&f, f.failed));
+}
+
+/**
+ * tail_file - Copies the last lines of the input of a filter.
+ * @f: The filter.
+ * @n: The number of lines, or of bytes.
+ * @bytes: Set if @n counts bytes.
+ * @from: Set to copy from line or byte @n on instead.
+ *
+ * Input that cannot be read backwards is read to its end, keeping only
+ * about the last @n lines in the buffer.
+ */
+void tail_file(filter_t *f, long n, int bytes, int from)
+{
+	struct stat st;
+
+	if (from)
+		head_file(f, n > 0 ? n - 1 : 0, bytes, 0);
+	else if (!fstat(f->fd, &st) && S_ISREG(st.st_mode) &&
+			lseek(f->fd, 0, SEEK_CUR) != -1)
+	{
+		tail_seek(f, &st, n, bytes);
+		return;
+	}
+	else
+	{
+		while (filter_fill(f) > 0)
+			if (f->in.len - f->pos > FILTER_BUF)
+				f->pos = tail_start(f, n, bytes);
+		f->pos = tail_start(f, n, bytes);
+	}
+	tail_rest(f);
+}
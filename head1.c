@@ -0,0 +1,93 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+
+/**
+ * tail_seek - Copies the last lines of a regular file.
+ * @f: The filter, reading the file.
+ * @st: The status of the file.
+ * @n: The number of lines, or of bytes.
+ * @bytes: Set if @n counts bytes.
+ *
+ * The file is read backwards from its end in FILTER_BUF blocks, with
+ * memrchr() finding the newlines, until @n lines are found; the rest is
+ * copied from there by tail_rest(), which keeps it in the kernel.
+ */
+void tail_seek(filter_t *f, struct stat *st, long n, int bytes)
+{
+	off_t cur = lseek(f->fd, 0, SEEK_CUR), end = st->st_size, start = cur;
+	ssize_t blk;
+	size_t k;
+	char *nl;
+
+	if (bytes || !n)
+		start = end - cur > n ? end - n : cur;
+	else if (!sb_grow(&f->in, FILTER_BUF))
+		while (start == cur && end > cur)
+		{
+			blk = end - cur < FILTER_BUF ? end - cur : FILTER_BUF;
+			if (pread(f->fd, f->in.s, blk, end - blk) != blk)
+				break;
+			k = blk;
+			if (end == st->st_size && f->in.s[k - 1] == '\n')
+				k--;
+			end -= blk;
+			while (start == cur && (nl = memrchr(f->in.s, '\n', k)))
+			{
+				k = nl - f->in.s;
+				if (!--n)
+					start = end + k + 1;
+			}
+		}
+	lseek(f->fd, start, SEEK_SET);
+	tail_rest(f);
+}
+
+/**
+ * tail_start - Finds where the last lines of a filter's input start.
+ * @f: The filter; only the bytes from f->pos on are looked at.
+ * @n: The number of lines, or of bytes.
+ * @bytes: Set if @n counts bytes.
+ *
+ * A last line without a newline counts as a line.
+ *
+ * Return: The offset in f->in of the first byte of the last @n lines,
+ *         or f->pos if there are fewer.
+ */
+size_t tail_start(filter_t *f, long n, int bytes)
+{
+	char *s = f->in.s + f->pos, *nl;
+	size_t k = f->in.len - f->pos;
+
+	if (bytes || !n)
+		return ((size_t)n < k ? f->in.len - n : f->pos);
+	if (k && s[k - 1] == '\n')
+		k--;
+	while ((nl = memrchr(s, '\n', k)))
+	{
+		k = nl - s;
+		if (!--n)
+			return (f->pos + k + 1);
+	}
+	return (f->pos);
+}
+
+/**
+ * tail_rest - Copies the rest of the input of a filter.
+ * @f: The filter.
+ *
+ * The bytes read but not used are written first; what was not read yet
+ * is copied by copy_fd().
+ */
+void tail_rest(filter_t *f)
+{
+	info_t *info = f->info;
+
+	filter_put(f, f->in.s + f->pos, f->in.len - f->pos);
+	f->pos = f->in.len;
+	if (f->eof || filter_flush(f) || !copy_fd(f->fd, STDOUT_FILENO))
+		return;
+	f->err = errno;
+	if (errno != EPIPE)
+		fprintf(stderr, "%s: %d: %s: %s: %s\n", info->fname, info->line_count,
+				info->argv[0], f->name, strerror(errno));
+}
@@ -0,0 +1,195 @@
+#include "myshell.h"
+
+/**
+ * lex_next - Advances the lexer to the next token.
+ * @lx: The lexer.
+ *
+ * Blanks, backslash-newline continuations and comments between tokens
+ * are skipped, and so are the here-document bodies read for a line once
+ * its newline is reached. The previous TOK_WORD text is freed unless it
+ * was taken. Digits written right before a redirection operator are its
+ * descriptor number, left in lx->fd.
+ *
+ * Return: The TOK_* type of the new token, also stored in lx->tok.
+ */
+int lex_next(lexer_t *lx)
+{
+	static char *ops[] = {";;", "&&", "||", ";", "|", "(", ")", "\n", "<<<",
+		"<<-", "<<", "<&", "<>", "<", ">>", ">&", ">|", ">", NULL};
+	static const int types[] = {TOK_DSEMI, TOK_AND_IF, TOK_OR_IF, TOK_SEMI,
+		TOK_PIPE, TOK_LPAREN, TOK_RPAREN, TOK_NEWLINE, TOK_REDIR, TOK_REDIR,
+		TOK_REDIR, TOK_REDIR, TOK_REDIR, TOK_REDIR, TOK_REDIR, TOK_REDIR,
+		TOK_REDIR, TOK_REDIR};
+	char *s = lx->src;
+	size_t a;
+
+	free(lx->word);
+	lx->word = NULL;
+	while (s[lx->pos] == ' ' || s[lx->pos] == '\t' ||
+			(s[lx->pos] == '\\' && s[lx->pos + 1] == '\n') || s[lx->pos] == '#')
+	{
+		if (s[lx->pos] == '#')
+			lx->pos += strcspn(s + lx->pos, "\n");
+		else if (s[lx->pos] == '\\')
+			lx->pos += 2, lx->line++;
+		else
+			lx->pos++;
+	}
+	lx->text = "end of file";
+	if (!s[lx->pos])
+		return (lx->tok = TOK_EOF);
+	if (lex_ionum(lx) == -1)
+		return (lx->tok = lex_word(lx));
+	for (a = 0; ops[a]; a++)
+		if (!strncmp(s + lx->pos, ops[a], strlen(ops[a])))
+		{
+			lx->pos += strlen(ops[a]);
+			lx->text = *ops[a] == '\n' ? "newline" : ops[a];
+			lx->line += *ops[a] == '\n';
+			if (*ops[a] == '\n' && lx->hdoc)
+			{
+				lx->pos = lx->hdoc, lx->line += lx->hdoc_lines;
+				lx->hdoc = 0, lx->hdoc_lines = 0;
+			}
+			return (lx->tok = types[a]);
+		}
+	return (lx->tok = lex_word(lx));
+}
+
+/**
+ * lex_word - Scans a word token.
+ * @lx: The lexer, positioned on the first character of the word.
+ *
+ * The word is kept as written, quotes included, for expansion to handle
+ * later; only backslash-newline continuations are removed. A NAME=(...)
+ * array list or a <(...) or >(...) process substitution, which may
+ * contain blanks and newlines, is part of a single word.
+ *
+ * Return: TOK_WORD, or TOK_EOF with lx->status set to PARSE_MORE when the
+ *         input ends inside a quote or list.
+ */
+int lex_word(lexer_t *lx)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	char *s = lx->src, c;
+	int depth = 0, open = 0;
+
+	while ((c = s[lx->pos]))
+	{
+		if (!depth && lex_meta(s + lx->pos) &&
+				(c != '(' || !sb.len || assign_len(sb.s) != sb.len))
+			break;
+		if (c == '\\' && s[lx->pos + 1])
+		{
+			if (s[lx->pos + 1] != '\n')
+				sb_add(&sb, s + lx->pos, 2);
+			lx->line += s[lx->pos + 1] == '\n';
+			lx->pos += 2;
+			continue;
+		}
+		if (c == '\'' || c == '"' || (c == '$' && s[lx->pos + 1] == '{'))
+		{
+			if (lex_quoted(lx, &sb) == -1)
+				open = 1;
+			continue;
+		}
+		if ((c == '<' || c == '>') && s[lx->pos + 1] == '(')
+		{
+			sb_addc(&sb, c);
+			c = s[++lx->pos];
+		}
+		if (c == '(')
+			depth++;
+		else if (c == ')')
+			depth--;
+		lx->line += c == '\n';
+		sb_addc(&sb, c);
+		lx->pos++;
+	}
+	if (depth || open)
+	{
+		free(sb.s);
+		lx->status = PARSE_MORE;
+		lx->text = "end of file";
+		return (TOK_EOF);
+	}
+	lx->word = sb_take(&sb);
+	lx->text = lx->word;
+	return (TOK_WORD);
+}
+
+/**
+ * lex_quoted - Copies a quoted section or ${...} reference of a word.
+ * @lx: The lexer, positioned on the opening quote or on the '$' of "${".
+ * @sb: Receives the section, delimiters included.
+ *
+ * Return: 0 on success, -1 if the input ends before the section closes
+ *         (the lexer is then left at the end of the input).
+ */
+int lex_quoted(lexer_t *lx, strbuf_t *sb)
+{
+	char *s = lx->src, close = s[lx->pos] == '$' ? '}' : s[lx->pos];
+	size_t a = lx->pos + (close == '}' ? 2 : 1);
+	int line = lx->line;
+
+	for (; s[a] && s[a] != close; a++)
+	{
+		if (s[a] == '\\' && close != '\'' && s[a + 1])
+			a++;
+		line += s[a] == '\n';
+	}
+	if (!s[a])
+	{
+		lx->pos = a;
+		return (-1);
+	}
+	sb_add(sb, s + lx->pos, a + 1 - lx->pos);
+	lx->pos = a + 1;
+	lx->line = line;
+	return (0);
+}
+
+/**
+ * lex_meta - Checks for a blank or operator that ends a word.
+ * @p: The text to check.
+ *
+ * Return: The length of the blank or operator at @p, or 0 if @p
+ *         continues a word.
+ */
+size_t lex_meta(const char *p)
+{
+	if (*p == ' ' || *p == '\t' || *p == '\n' || *p == ';' || *p == '(' ||
+			*p == ')' || *p == '|')
+		return (p[1] == '|' && *p == '|' ? 2 : 1);
+	if (*p == '&' && p[1] == '&')
+		return (2);
+	if ((*p == '<' || *p == '>') && p[1] != '(')
+		return (1 + (p[1] == *p || p[1] == '&' || (*p == '<' && p[1] == '>') ||
+					(*p == '>' && p[1] == '|')));
+	return (0);
+}
+
+/**
+ * lex_words - Splits text into raw words the way the lexer would.
+ * @text: The text, e.g. the inside of an array list or an alias value.
+ *
+ * Operators and newlines only separate words; quotes stay in the words.
+ *
+ * Return: A newly allocated vector (free with free_strn()), or NULL if
+ *         @text holds no words.
+ */
+char **lex_words(char *text)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	lexer_t lx;
+
+	memset(&lx, 0, sizeof(lx));
+	lx.src = text;
+	while (lex_next(&lx) != TOK_EOF)
+		if (lx.tok == TOK_WORD)
+		{
+			wl_push(&wl, lx.word);
+			lx.word = NULL;
+		}
+	return (wl.v);
+}
@@ -0,0 +1,107 @@
+#include "myshell.h"
+
+/**
+ * lex_heredoc - Reads the body of a here-document.
+ * @lx: The lexer, on the delimiter word.
+ * @word: The delimiter as written.
+ * @strip: Non-zero for <<-, which strips leading tabs from every line.
+ * @fd: The descriptor it redirects.
+ *
+ * The body starts on the line after the current one, or after the body
+ * of an earlier here-document of the same line, and ends at a line
+ * holding only the delimiter.
+ *
+ * Return: The redirection (see parse_redir()), or NULL with lx->status
+ *         set to PARSE_MORE if the input ends first.
+ */
+char *lex_heredoc(lexer_t *lx, const char *word, int strip, int fd)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	char *delim = lex_delim(word), *s = lx->src, *nl, num[16];
+	size_t at = lx->hdoc, n, tabs, len = delim ? strlen(delim) : 0;
+	int lines = 0;
+
+	nl = at ? NULL : strchr(s + lx->pos, '\n');
+	if (nl)
+		at = nl - s + 1;
+	sprintf(num, "%d%c", fd, word[strcspn(word, "'\"\\")] ? 'h' : 'H');
+	sb_add(&sb, num, strlen(num));
+	while (delim && at && s[at])
+	{
+		n = strcspn(s + at, "\n");
+		for (tabs = 0; strip && s[at + tabs] == '\t'; tabs++)
+			;
+		lines++;
+		if (n - tabs == len && !strncmp(s + at + tabs, delim, len))
+		{
+			free(delim);
+			lx->hdoc = at + n + (s[at + n] == '\n');
+			lx->hdoc_lines += lines;
+			return (sb_take(&sb));
+		}
+		sb_add(&sb, s + at + tabs, n - tabs + (s[at + n] == '\n'));
+		at += n + (s[at + n] == '\n');
+	}
+	free(delim);
+	free(sb.s);
+	lx->status = PARSE_MORE;
+	lx->text = "end of file";
+	return (NULL);
+}
+
+/**
+ * lex_delim - Removes the quotes from a here-document delimiter.
+ * @word: The delimiter as written.
+ *
+ * Return: The delimiter, newly allocated, or NULL if allocation fails.
+ */
+char *lex_delim(const char *word)
+{
+	char *d = malloc(strlen(word) + 1), *p = d;
+
+	if (!d)
+		return (NULL);
+	for (; *word; word++)
+		if (*word == '\\' && word[1])
+			*p++ = *++word;
+		else if (*word != '\'' && *word != '"')
+			*p++ = *word;
+	*p = '\0';
+	return (d);
+}
+
+/**
+ * lex_ionum - Reads the descriptor number written before a redirection.
+ * @lx: The lexer, on the first character of a token.
+ *
+ * A {NAME} or {NAME[index]} written there instead names the descriptor
+ * by a variable; lx->fd is then -2 and lx->fdname points at the NAME.
+ *
+ * Return: 0 with the lexer past the digits, if any, and lx->fd set to
+ *         their value (-1 when there are none); -1 if the token is a
+ *         <(...) or >(...) word instead of an operator.
+ */
+int lex_ionum(lexer_t *lx)
+{
+	char *s = lx->src + lx->pos;
+	size_t n;
+	int fd = 0;
+
+	lx->fd = -1;
+	for (n = 0; s[n] >= '0' && s[n] <= '9'; n++)
+		if (fd < 100000)
+			fd = fd * 10 + s[n] - '0';
+	if (!n && *s == '{' && var_name_len(s + 1))
+	{
+		n = 1 + var_name_len(s + 1);
+		if (s[n] == '[' && s[n + strcspn(s + n, "]} \t\n")] == ']')
+			n += strcspn(s + n, "]") + 1;
+		n = s[n] == '}' ? n + 1 : 0;
+		fd = -2;
+	}
+	if ((s[n] == '<' || s[n] == '>') && s[n + 1] == '(')
+		return (-1);
+	if (n && (s[n] == '<' || s[n] == '>'))
+		lx->fd = fd, lx->fdname = s + 1, lx->pos += n;
+	return (0);
+}
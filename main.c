@@ -20,7 +20,7 @@ int main(int ac, char **av)
 			: "=r" (fd)
 			: "r" (fd));
 	/* Check if a command-line argument (input file) is provided */
-	if (ac == 2)
+	if (ac >= 2)
 	{
 		fd = open(av[1], O_RDONLY); /* Open the file for reading */
 		if (fd == -1)
@@ -36,10 +36,23 @@ int main(int ac, char **av)
 			}
 			return (EXIT_FAILURE); /* Exit with failure status on other errors */
 		}
+		/* Keep descriptors 0 to 9 free for the script's own redirections */
+		info.readfd = fcntl(fd, F_DUPFD_CLOEXEC, REDIR_FDS);
+		if (info.readfd != -1)
+		{
+			close(fd);
+			fd = info.readfd;
+		}
 		info.readfd = fd; /* Set 'readfd' in the 'info' structure */
+		/* Further arguments are the script's $1, $2, ... */
+		info.posv = av + 2;
+		info.posc = ac - 2;
 	}
 	/* Populate environment variables list */
 	populateEnv_list(&info);
+	/* A script file is compiled as a whole, or loaded from the cache */
+	if (ac >= 2)
+		info.script = script_cache(&info, fd);
 	/* Read command history */
 	read_histFile(&info);
 	/* Start the shell */
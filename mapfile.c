@@ -0,0 +1,122 @@
+#include "myshell.h"
+
+/**
+ * mapfile_slurp - Reads everything left on a file descriptor.
+ * @fd: The file descriptor.
+ * @len: Receives the number of bytes read.
+ *
+ * A regular file is read with one buffer sized from fstat(), so a whole
+ * file costs a single read() in the common case; pipes and terminals are
+ * read in MAPFILE_CHUNK pieces into a growing buffer.
+ *
+ * Return: The newly allocated data (NUL-terminated), or NULL on failure.
+ */
+char *mapfile_slurp(int fd, size_t *len)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	struct stat st;
+	size_t want = MAPFILE_CHUNK;
+	ssize_t r;
+	off_t pos;
+
+	if (!fstat(fd, &st) && S_ISREG(st.st_mode))
+	{
+		pos = lseek(fd, 0, SEEK_CUR);
+		if (pos >= 0 && st.st_size > pos)
+			want = st.st_size - pos + 1; /* +1 sees EOF in the same pass */
+	}
+	for (;;)
+	{
+		if (sb_grow(&sb, want))
+			return (free(sb.s), NULL);
+		r = read(fd, sb.s + sb.len, sb.cap - sb.len - 1);
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r <= 0)
+			break;
+		sb.len += r;
+		want = MAPFILE_CHUNK;
+	}
+	*len = sb.len;
+	sb.s[sb.len] = '\0';
+	return (sb_take(&sb));
+}
+
+/**
+ * mapfile_split - Appends each line of a buffer to an array.
+ * @arr: The indexed array receiving the lines.
+ * @buf: The data.
+ * @len: Length of @buf.
+ * @trim: Non-zero to drop the trailing newline of each line (-t).
+ * @max: Maximum number of lines to store, 0 for no limit (-n).
+ *
+ * Lines are located with memchr() rather than byte by byte.
+ *
+ * Return: The number of lines stored.
+ */
+int mapfile_split(array_t *arr, char *buf, size_t len, int trim, long max)
+{
+	char *p = buf, *end = buf + len, *nl, *line;
+	int n = 0;
+	size_t l;
+
+	while (p < end && (!max || n < max))
+	{
+		nl = memchr(p, '\n', end - p);
+		l = nl ? (size_t)(nl - p) + !trim : (size_t)(end - p);
+		line = malloc(l + 1);
+		if (!line)
+			break;
+		memcpy(line, p, l);
+		line[l] = '\0';
+		if (array_append(arr, line))
+			break;
+		n++;
+		p = nl ? nl + 1 : end;
+	}
+	return (n);
+}
+
+/**
+ * mapfile_cmd - Loads lines from a file descriptor into an indexed array.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: mapfile [-t] [-n count] [-u fd] [array]  (also readarray)
+ * The array defaults to MAPFILE and is emptied first.
+ *
+ * Return: 0 on success, 1 on error, 2 on a usage error.
+ */
+int mapfile_cmd(info_t *info)
+{
+	int a, fd = 0, trim = 0;
+	long max = 0;
+	char *name = "MAPFILE", *buf;
+	size_t len;
+	var_t *v;
+
+	for (a = 1; info->argv[a] && info->argv[a][0] == '-'; a++)
+	{
+		if (!strcmp(info->argv[a], "-t"))
+			trim = 1;
+		else if (!strcmp(info->argv[a], "-n") && info->argv[a + 1])
+			max = strtol(info->argv[++a], NULL, 10);
+		else if (!strcmp(info->argv[a], "-u") && info->argv[a + 1])
+			fd = strtol(info->argv[++a], NULL, 10);
+		else
+			return (printErro(info, "usage: mapfile [-t] [-n count] [-u fd] [array]"),
+					2);
+	}
+	if (info->argv[a])
+		name = info->argv[a];
+	v = array_var(info, name, lenstrn(name), ARRAY_DENSE, 0);
+	if (!v || v->array->kind == ARRAY_ASSOC)
+		return (1);
+	array_free(v->array);
+	v->array = array_new(ARRAY_DENSE);
+	buf = mapfile_slurp(fd, &len);
+	if (!buf || !v->array)
+		return (free(buf), 1);
+	mapfile_split(v->array, buf, len, trim, max);
+	free(buf);
+	return (0);
+}
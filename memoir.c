@@ -130,15 +130,15 @@ int read_histFile(info_t *info)
 	if (!fstat(fd, &st))
 		fsize = st.st_size;
 	if (fsize < 2)
-		return (0);
+		return (close(fd), 0);
 	buffer = malloc(sizeof(char) * (fsize + 1));
 	if (!buffer)
-		return (0);
+		return (close(fd), 0);
 	rdlen = read(fd, buffer, fsize);
 	buffer[fsize] = 0;
+	close(fd);
 	if (rdlen <= 0)
 		return (free(buffer), 0);
-	close(fd);
 	for (a = 0; a < fsize; a++)
 		if (buffer[a] == '\n')
 		{
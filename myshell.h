@@ -10,17 +10,16 @@
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <dirent.h>
+#include <pthread.h>
 #include <string.h>
+#include <regex.h>
 
 #define BUFFER_FLUSH -1
 #define READ_BUFFER_SIZE 1024
 #define WRITE_BUFFER_SIZE 1024
 
-#define CMND_CHAIN 3
-#define CMND_AND 2
-#define CMND_OR 1
-#define CMND_NORM 0
-
 #define CONVERTING_UNSIGNED 2
 #define CONVERTING_LOWERCASE 1
 
@@ -30,6 +29,119 @@
 #define FILE_HISTORY ".simple_shell_history"
 #define MAX_HISTORY 4096
 
+#define SYMTAB_BUCKETS 64
+#define SYMTAB_LOCAL_BUCKETS 8
+
+#define VAR_EXPORT 1
+#define VAR_READONLY 2
+#define VAR_NOVALUE 4
+
+#define ARRAY_DENSE 0
+#define ARRAY_SPARSE 1
+#define ARRAY_ASSOC 2
+
+#define MAPFILE_CHUNK 65536
+
+#define NODE_SIMPLE 0
+#define NODE_AND 1
+#define NODE_OR 2
+#define NODE_NOT 3
+#define NODE_GROUP 4
+#define NODE_FUNC 5
+#define NODE_IF 6
+#define NODE_WHILE 7
+#define NODE_UNTIL 8
+#define NODE_FOR 9
+#define NODE_CASE 10
+#define NODE_ARM 11
+#define NODE_SUBSHELL 12
+#define NODE_PIPE 13
+#define NODE_COND 14
+
+#define TOK_EOF 0
+#define TOK_WORD 1
+#define TOK_NEWLINE 2
+#define TOK_SEMI 3
+#define TOK_AND_IF 4
+#define TOK_OR_IF 5
+#define TOK_LPAREN 6
+#define TOK_RPAREN 7
+#define TOK_DSEMI 8
+#define TOK_PIPE 9
+#define TOK_REDIR 10
+
+#define PARSE_OK 0
+#define PARSE_MORE 1
+#define PARSE_ERROR 2
+
+#define UNWIND_RETURN 1
+#define UNWIND_EXIT 2
+#define UNWIND_BREAK 4
+#define UNWIND_CONTINUE 8
+
+#define FUNC_BUCKETS 64
+#define CACHE_MAGIC "hshc\0\0\0\3"
+#define REDIR_FDS 10
+#define GLOB_MAX_THREADS 64
+#define GLOB_MAX_OPEN 256
+#define PATTERN_BUCKETS 64
+#define PATTERN_MAX 256
+#define FUNC_MAX_DEPTH 1000
+
+#define BRACE_TEXT 0
+#define BRACE_LIST 1
+#define BRACE_SEQ 2
+#define BRACE_MAX 262144
+
+#define COPY_RANGE 0
+#define COPY_SENDFILE 1
+#define COPY_SPLICE 2
+#define COPY_CHUNK 0x40000000
+#define COPY_BUF 131072
+
+#define COND_STREQ 0
+#define COND_STRNE 1
+#define COND_REGEX 2
+#define COND_STRLT 3
+#define COND_STRGT 4
+#define COND_EQ 5
+#define COND_NE 6
+#define COND_LT 7
+#define COND_LE 8
+#define COND_GT 9
+#define COND_GE 10
+#define COND_NT 11
+#define COND_OT 12
+#define COND_EF 13
+#define REGEX_MAX 32
+
+#define READ_AHEAD 65536
+#define READ_PEEK 65536
+
+#define FILTER_BUF 131072
+#define CUT_MAX 1048576
+
+#define OP_END 0
+#define OP_CMD 1
+#define OP_JMP 2
+#define OP_JZ 3
+#define OP_JNZ 4
+#define OP_NOT 5
+#define OP_TRUE 6
+#define OP_DEFUN 7
+#define OP_CASE 8
+#define OP_MATCH 9
+#define OP_LOOP 10
+#define OP_FOR 11
+#define OP_NEXT 12
+#define OP_AGAIN 13
+#define OP_POPLOOP 14
+#define OP_REDIR 15
+#define OP_UNREDIR 16
+#define OP_SUBSHELL 17
+#define OP_PIPE 18
+#define OP_COND 19
+
 extern char **environ;
 
 /**
@@ -45,6 +157,615 @@ typedef struct liststr
 	struct liststr *next;/* Pointer to the next node in the list */
 } list_t;
 
+/**
+ * struct arrentry - One element of a sparse or associative array
+ * @key: The key of an associative element, NULL in a sparse array
+ * @idx: The index of a sparse element, or the cached key hash of an
+ *       associative one
+ * @val: The value; NULL marks a free slot or, with @key set, a tombstone
+ */
+typedef struct arrentry
+{
+	char *key;
+	long idx;
+	char *val;
+} arrentry_t;
+
+/**
+ * struct shellarray - An indexed or associative array variable
+ * @kind: ARRAY_DENSE, ARRAY_SPARSE or ARRAY_ASSOC
+ * @vec: Dense slots by index, NULL where an index is unset
+ * @ent: Sparse pairs sorted by index, or the associative hash slots
+ * @len: Dense: highest index + 1; sparse: pairs used; assoc: slots used
+ *       including tombstones
+ * @cap: Allocated dense slots, sparse pairs or associative slots
+ * @count: Number of set elements
+ */
+typedef struct shellarray
+{
+	int kind;
+	char **vec;
+	arrentry_t *ent;
+	size_t len;
+	size_t cap;
+	size_t count;
+} array_t;
+
+/**
+ * struct shellvar - A shell variable stored in a symbol table bucket chain
+ * @pair: The "NAME=value" string, handed to children as-is as an envp entry
+ * @namelen: Length of the NAME part of @pair
+ * @hash: Cached hash of the name, reused when the table grows
+ * @flags: VAR_EXPORT, VAR_READONLY and VAR_NOVALUE attribute bits
+ * @array: The elements when the variable is an array, NULL for a scalar
+ * @next: The next variable in the same bucket
+ */
+typedef struct shellvar
+{
+	char *pair;
+	size_t namelen;
+	unsigned int hash;
+	int flags;
+	array_t *array;
+	struct shellvar *next;
+} var_t;
+
+/**
+ * struct symtab - One scope of shell variables
+ * @bucket: Array of bucket chains
+ * @size: Number of buckets, always a power of two
+ * @count: Number of variables held in this scope
+ * @parent: The enclosing scope, NULL for the global scope
+ */
+typedef struct symtab
+{
+	var_t **bucket;
+	size_t size;
+	size_t count;
+	struct symtab *parent;
+} symtab_t;
+
+/**
+ * struct strbuf - A growable NUL-terminated string
+ * @s: The string, NULL until something is appended
+ * @len: Length of the string
+ * @cap: Allocated size of @s
+ */
+typedef struct strbuf
+{
+	char *s;
+	size_t len;
+	size_t cap;
+} strbuf_t;
+
+/**
+ * struct wordlist - A growable NULL-terminated vector of words
+ * @v: The words, NULL until something is pushed
+ * @n: Number of words
+ * @cap: Allocated slots of @v
+ * @pattern: Set to build the words as patterns for globbing: quoted
+ *           pattern characters are escaped with a backslash
+ */
+typedef struct wordlist
+{
+	char **v;
+	size_t n;
+	size_t cap;
+	int pattern;
+} wordlist_t;
+
+/**
+ * struct node - A node of a parsed command tree
+ * @type: The NODE_* kind of the node
+ * @words: The words as written, quotes included: the command of
+ *         NODE_SIMPLE, the list of NODE_FOR (NULL without 'in'), the
+ *         subject of NODE_CASE, the patterns of NODE_ARM or the
+ *         expression of NODE_COND
+ * @name: The name of a NODE_FUNC function or NODE_FOR variable
+ * @left: The left side of && and ||, the command of '!', the list of a
+ *        { } group or ( ) subshell, the first stage of a pipeline, the
+ *        body of a function definition or case arm, or the condition of
+ *        if, while and until
+ * @right: The right side of && and ||, the 'then' list of if, the body
+ *         of a loop, or the arms of a case
+ * @alt: The 'else' list of if; an elif is a nested NODE_IF
+ * @redirs: The redirections of a simple or compound command, see
+ *          parse_redir()
+ * @next: The next command of the same list, the next stage of a
+ *        pipeline, or the next case arm
+ * @line: The input line the command started on, for error messages
+ */
+typedef struct node
+{
+	int type;
+	char **words;
+	char **redirs;
+	char *name;
+	struct node *left;
+	struct node *right;
+	struct node *alt;
+	struct node *next;
+	int line;
+} node_t;
+
+/**
+ * struct lexer - Tokenizer state over a block of shell input
+ * @src: The input text
+ * @pos: Offset of the next unread character of @src
+ * @tok: The TOK_* type of the current token
+ * @word: The current TOK_WORD text (owned by the lexer until taken)
+ * @text: The current token as printed in syntax errors
+ * @line: The input line the lexer is on
+ * @status: PARSE_MORE once the input ends inside a construct,
+ *          PARSE_ERROR on a syntax error
+ * @hdoc: Offset of the input after the here-document bodies read for the
+ *        current line, 0 if there are none; the newline ending the line
+ *        skips to it
+ * @hdoc_lines: The number of lines those bodies take
+ * @fd: The descriptor number written before the current TOK_REDIR
+ *      operator, -1 if there is none, -2 for a {NAME} one
+ * @fdname: The NAME of a {NAME} descriptor, up to its '}'
+ */
+typedef struct lexer
+{
+	char *src;
+	size_t pos;
+	int tok;
+	char *word;
+	char *text;
+	int line;
+	int status;
+	size_t hdoc;
+	int hdoc_lines;
+	int fd;
+	char *fdname;
+} lexer_t;
+
+/**
+ * struct instr - One bytecode instruction of a compiled program
+ * @op: The OP_* operation
+ * @a: The first operand: a command index or a jump target
+ * @b: The second operand: a jump target
+ */
+typedef struct instr
+{
+	int op;
+	int a;
+	int b;
+} instr_t;
+
+struct passinfo;
+
+/**
+ * struct command - A command, word list or name used by a program
+ * @words: The words as written, split once at parse time
+ * @name: The first non-assignment word when it needs no expansion
+ * @builtin: The builtin @name resolves to, looked up when compiled
+ * @sub: The compiled body of a function definition or subshell, or a
+ *       compound pipeline stage
+ * @redirs: The redirections, see parse_redir()
+ * @line: The input line the command started on
+ */
+typedef struct command
+{
+	char **words;
+	char **redirs;
+	char *name;
+	int (*builtin)(struct passinfo *);
+	struct prog *sub;
+	int line;
+} cmd_t;
+
+/**
+ * struct prog - A compiled program: a script, command line or function
+ * @code: The instructions; jump targets are indexes into it
+ * @len: Number of instructions
+ * @cap: Allocated instruction slots
+ * @cmds: The commands and word lists the instructions refer to
+ * @ncmds: Number of commands
+ * @cmdcap: Allocated command slots
+ * @loops: The deepest loop nesting, which sizes the loop stack
+ * @nest: The loop nesting at the point being compiled
+ * @err: Set when compiling ran out of memory
+ * @refs: Number of owners; function bodies may be shared and may be
+ *        running while they are redefined
+ */
+typedef struct prog
+{
+	instr_t *code;
+	int len;
+	int cap;
+	cmd_t *cmds;
+	int ncmds;
+	int cmdcap;
+	int loops;
+	int nest;
+	int err;
+	int refs;
+} prog_t;
+
+/**
+ * struct brace - One part of a word with brace expansions
+ * @kind: BRACE_TEXT, BRACE_LIST or BRACE_SEQ
+ * @text: The raw text of a BRACE_TEXT part
+ * @alts: The alternatives of a BRACE_LIST part, each a list of parts
+ *        (NULL for an empty one)
+ * @nalts: The number of alternatives
+ * @lo: The first value of a BRACE_SEQ part
+ * @step: The distance between its values, negative when counting down
+ * @width: The width numbers are zero-padded to, 0 for none
+ * @alpha: Set when the values are characters rather than numbers
+ * @count: The number of values of this part
+ * @stride: The number of words the parts after it make, so the value of
+ *          this part in word i is i / stride % count
+ * @next: The next part of the word
+ */
+typedef struct brace
+{
+	int kind;
+	char *text;
+	struct brace **alts;
+	size_t nalts;
+	long lo;
+	long step;
+	int width;
+	int alpha;
+	unsigned long count;
+	unsigned long stride;
+	struct brace *next;
+} brace_t;
+
+/**
+ * struct loop - A loop being run by the interpreter
+ * @brk: Where 'break' goes: the loop's OP_POPLOOP
+ * @cont: Where 'continue' goes: the condition or the OP_NEXT
+ * @vals: The expanded word list of a for loop
+ * @i: Index of the next value of @vals
+ * @n: Number of values in @vals
+ * @gens: For each value that is a brace expansion with nothing else to
+ *        expand, its generator; the words are made one per iteration
+ * @ngens: The number of entries of @gens
+ * @gi: Index of the next word of the current generator
+ * @status: The status of the last body run, the status of the loop
+ */
+typedef struct loop
+{
+	int brk;
+	int cont;
+	char **vals;
+	size_t i;
+	size_t n;
+	brace_t **gens;
+	size_t ngens;
+	unsigned long gi;
+	int status;
+} loop_t;
+
+/**
+ * struct redirframe - The redirections of a running compound command
+ * @saved: The descriptors saved by redir_apply()
+ * @procsubs: The process substitutions its redirections started
+ * @depth: The number of loops running when it started; a break or
+ *         continue leaving one of them undoes the redirections
+ * @next: The frame of an enclosing compound command
+ */
+typedef struct redirframe
+{
+	int saved[REDIR_FDS];
+	struct procsub *procsubs;
+	int depth;
+	struct redirframe *next;
+} redirframe_t;
+
+/**
+ * struct cachehdr - The header of a compiled script in the cache
+ * @magic: CACHE_MAGIC, identifying the file and the format version
+ * @dev: The device of the script
+ * @ino: The inode of the script
+ * @size: The size of the script in bytes
+ * @mtime: The modification time of the script
+ * @mtime_ns: The nanoseconds of @mtime
+ * @hash: The hash of the script's contents
+ */
+typedef struct cachehdr
+{
+	char magic[8];
+	unsigned long dev;
+	unsigned long ino;
+	long size;
+	long mtime;
+	long mtime_ns;
+	unsigned int hash;
+} cachehdr_t;
+
+/**
+ * struct cachereader - A position in a mapped cache file
+ * @p: The next byte to read
+ * @end: The end of the file
+ */
+typedef struct cachereader
+{
+	const char *p;
+	const char *end;
+} cachereader_t;
+
+/**
+ * struct procsub - A running <(...) or >(...) process substitution
+ * @pid: The process running the command
+ * @fd: The shell's end of its pipe, named /dev/fd/N on the command line
+ * @next: The next process substitution of the same command
+ */
+typedef struct procsub
+{
+	pid_t pid;
+	int fd;
+	struct procsub *next;
+} procsub_t;
+
+/**
+ * struct coproc - A coprocess started by 'coproc'
+ * @name: The NAME its variables use, NULL once another one took it
+ * @pid: The process running it, 0 once it has been waited for
+ * @rfd: The shell's end reading its output, -1 once closed
+ * @wfd: The shell's end writing its input, -1 once closed
+ * @next: The coprocess started before it
+ */
+typedef struct coproc
+{
+	char *name;
+	pid_t pid;
+	int rfd;
+	int wfd;
+	struct coproc *next;
+} coproc_t;
+
+/**
+ * struct readopts - The options of one 'read' command
+ * @raw: Set by -r: backslashes are not escapes
+ * @delim: The byte ending the input, a newline unless -d gives another
+ * @max: The most bytes to read (-n), -1 for no limit
+ * @fd: The descriptor read (-u), 0 by default
+ * @timeout: The milliseconds -t allows, -1 for no limit
+ * @deadline: When the timeout runs out, as read_now() tells time
+ */
+typedef struct readopts
+{
+	int raw;
+	char delim;
+	long max;
+	int fd;
+	long timeout;
+	long deadline;
+} readopts_t;
+
+/**
+ * struct timeout - The limit 'timeout' puts on the command it runs
+ * @secs: How long the command may run, in seconds
+ * @sig: The signal it is sent when the time is up
+ * @kill: How long after @sig it is sent SIGKILL, 0 for never
+ * @group: Set when the command leads a process group of its own, which
+ *         is signalled as a whole
+ * @fired: 1 once @sig was sent, 2 once SIGKILL was
+ */
+typedef struct timeout
+{
+	double secs;
+	int sig;
+	double kill;
+	int group;
+	int fired;
+} timeout_t;
+
+/**
+ * struct ulimit - A resource limit the 'ulimit' builtin knows
+ * @opt: Its option letter
+ * @res: The resource, -1 for the pipe size, which cannot be changed
+ * @factor: The number of bytes, or other units, in each unit shown
+ * @desc: What 'ulimit -a' calls it
+ * @unit: The unit shown, NULL for none
+ */
+typedef struct ulimit
+{
+	char opt;
+	int res;
+	int factor;
+	char *desc;
+	char *unit;
+} ulimit_t;
+
+/**
+ * struct condregex - A regular expression compiled for =~
+ * @text: The expression as expanded
+ * @re: The compiled expression
+ * @ok: Set if it compiled; @re is only valid then
+ * @next: The expression used less recently
+ */
+typedef struct condregex
+{
+	char *text;
+	regex_t re;
+	int ok;
+	struct condregex *next;
+} condregex_t;
+
+/**
+ * struct getopts - What 'getopts' keeps from one call to the next
+ * @optstring: The optstring @kinds was built from
+ * @kinds: For each byte, 1 if it is an option, 2 if it is one taking an
+ *         argument and 0 otherwise
+ * @optind: The OPTIND the last call left
+ * @pos: The offset of the next option within the argument at @optind,
+ *       0 when the next option starts a new argument
+ */
+typedef struct getopts
+{
+	char *optstring;
+	unsigned char kinds[256];
+	long optind;
+	int pos;
+} getopts_t;
+
+/**
+ * struct readahead - Input 'read' took from a regular file ahead of time
+ * @fd: The descriptor read
+ * @dev: The device of the file, to tell when @fd names another one
+ * @ino: The inode of the file
+ * @size: The size of the file when read, to tell when it changed
+ * @mtime: The modification time of the file when read
+ * @mtime_ns: The nanoseconds of @mtime
+ * @off: The file offset of @buf
+ * @pos: The offset in @buf where the next read command starts
+ * @len: The number of bytes in @buf
+ * @buf: READ_AHEAD bytes of the file
+ * @next: The buffer of another descriptor
+ */
+typedef struct readahead
+{
+	int fd;
+	dev_t dev;
+	ino_t ino;
+	off_t size;
+	long mtime;
+	long mtime_ns;
+	off_t off;
+	size_t pos;
+	size_t len;
+	char *buf;
+	struct readahead *next;
+} readahead_t;
+
+/**
+ * struct srcfile - A file compiled by 'source', kept for the next time
+ * @path: The file name as found
+ * @mtime: The modification time of the file when it was compiled
+ * @mtime_ns: The nanoseconds of @mtime
+ * @size: The size of the file when it was compiled
+ * @prog: The compiled file
+ * @next: The next file
+ */
+typedef struct srcfile
+{
+	char *path;
+	long mtime;
+	long mtime_ns;
+	long size;
+	prog_t *prog;
+	struct srcfile *next;
+} srcfile_t;
+
+/**
+ * struct globdir - A directory listing kept while a command is expanded
+ * @path: The directory, as named in the pattern
+ * @names: The sorted entries, pointing into @buf; "." and ".." are left
+ *         out
+ * @n: The number of entries
+ * @buf: The entry names, one after another
+ * @next: The next listing
+ */
+typedef struct globdir
+{
+	char *path;
+	char **names;
+	size_t n;
+	char *buf;
+	struct globdir *next;
+} globdir_t;
+
+/**
+ * struct pattern - A shell pattern compiled for bit-parallel matching
+ * @text: The pattern as given
+ * @hash: Cached hash of @text and @reverse
+ * @reverse: Set if compiled to match from the end of a string backwards
+ * @items: The number of items: single characters, [...] sets and stars
+ * @words: The number of unsigned longs in each mask
+ * @mask: 257 masks of @words each; mask c has bit k set if item k
+ *        matches byte c, and mask 256 marks the items that are stars
+ * @next: The next pattern in the same bucket
+ */
+typedef struct pattern
+{
+	char *text;
+	unsigned int hash;
+	int reverse;
+	size_t items;
+	size_t words;
+	unsigned long *mask;
+	struct pattern *next;
+} pattern_t;
+
+/**
+ * struct globtask - A directory waiting to be read by a ** walk
+ * @fd: The directory, opened relative to its parent
+ * @path: Its name as results show it, ending in '/' (empty for the base)
+ */
+typedef struct globtask
+{
+	int fd;
+	char *path;
+} globtask_t;
+
+/**
+ * struct globworker - A thread of a ** walk, with its own task queue
+ * @lock: Guards @tasks, @head and @n
+ * @tasks: The queued directories; the worker takes from the end, idle
+ *         workers steal from @head
+ * @head: Index of the oldest queued task
+ * @n: One past the newest queued task
+ * @cap: Allocated slots of @tasks
+ * @found: The names this worker matched
+ * @tree: The walk the worker belongs to
+ */
+typedef struct globworker
+{
+	pthread_mutex_t lock;
+	globtask_t *tasks;
+	size_t head;
+	size_t n;
+	size_t cap;
+	wordlist_t found;
+	struct globtree *tree;
+} globworker_t;
+
+/**
+ * struct globtree - A ** walk shared by its workers
+ * @workers: The workers
+ * @nworkers: The number of workers
+ * @lock: Guards @pending, @queued and @open
+ * @idle: Signalled when a task is queued or the walk ends
+ * @pending: The number of tasks queued or being run
+ * @queued: The number of tasks ever queued, so a worker that found
+ *          nothing to take can tell whether to wait
+ * @open: The number of directory descriptors held by tasks
+ * @last: The pattern entries must match, or NULL to collect every
+ *        directory for the components that follow
+ */
+typedef struct globtree
+{
+	globworker_t *workers;
+	int nworkers;
+	pthread_mutex_t lock;
+	pthread_cond_t idle;
+	long pending;
+	long queued;
+	long open;
+	pattern_t *last;
+} globtree_t;
+
+/**
+ * struct shellfunc - A shell function stored in the function table
+ * @name: The function name
+ * @hash: Cached hash of the name
+ * @body: The compiled body, run on every call without being parsed again
+ * @next: The next function in the same bucket
+ */
+typedef struct shellfunc
+{
+	char *name;
+	unsigned int hash;
+	prog_t *body;
+	struct shellfunc *next;
+} func_t;
+
 /**
  *struct passinfo - Container for holding various parameters to be passed
  *                  into a function, enabling a consistent prototype for
@@ -53,20 +774,50 @@ typedef struct liststr
  *@history: Linked list for command history.
  *@alias: Linked list for command aliases.
  *@path: a string path for the current command
- *@env: Linked list for environment variables.
+ *@vars: The innermost variable scope; its parent chain ends at the globals
  *@fname: The filename of the program
  *@argv: An array of strings created from the 'arg' field
- *@environ: A customized modified copy of the environment from 'env'
+ *@environ: envp built from the exported entries of 'vars'
  *@cmd_buffer: Address of a pointer to 'cmd_buf'; set to true when chaining
  *@argc: The count of arguments
  *@linecount_flag: Indicates whether to count this input line
  *@line_count: The count of encountered errors
  *@err_number: The error code for exit() calls
  *@status: The return status of the most recently executed command
- *@cmd_buffer_type: Type of command buffer (e.g., ||, &&, ;)
+ *@cmd_buffer_type: Unused since lists are parsed into trees
  *@env_changed: Set to true if the environment was altered
  *@readfd: The file descriptor from which to read line input
  *@historycount: The count of history line numbers
+ *@assignv: The leading NAME=value words split off the command line
+ *@assigns: The number of words in 'assignv'
+ *@funcs: The function table buckets, NULL until a function is defined
+ *@posv: The positional parameters $1, $2, ...
+ *@posc: The number of positional parameters, $#
+ *@depth: The number of function calls in progress
+ *@unwind: UNWIND_* bits set by return and exit to stop running lists
+ *@input_line: The number of input lines read so far
+ *@loops: The number of loops running in the current function
+ *@levels: The number of loops 'break' or 'continue' leaves
+ *@script: The script file compiled (or loaded from the cache) as a whole
+ *@cache_hits: The number of compiled forms found in the cache
+ *@cache_misses: The number of files that had to be compiled
+ *@sources: The files compiled by 'source'
+ *@sourced: The number of 'source' commands in progress
+ *@globdirs: The directories listed while globbing the current command
+ *@patterns: The compiled pattern buckets, NULL until a pattern is used
+ *@npatterns: The number of compiled patterns kept
+ *@procsubs: The process substitutions of the current command
+ *@fds: Bit N is set while descriptor N is held open by an exec line
+ *@keepfds: Set by exec to keep the redirections of the current command
+ *@nofork: Set in a pipeline stage's child, which runs its external
+ *         command in place instead of forking again
+ *@coprocs: The coprocesses whose pipes are open or which still run
+ *@readahead: The read-ahead buffers of the files 'read' reads
+ *@peek: The pipe 'read' copies a pipe's contents into to look at them
+ *@peekpid: The process that made @peek, 0 if there is none
+ *@getopts: The option table of the last 'getopts', NULL before one ran
+ *@regexes: The regular expressions =~ compiled, most recently used first
+ *@timeout: The limit of the 'timeout' command running, NULL if none is
  */
 typedef struct passinfo
 {
@@ -74,7 +825,7 @@ typedef struct passinfo
 	list_t *history;
 	list_t *alias;
 	char *path;
-	list_t *env;
+	symtab_t *vars;
 	char *fname;
 	char **argv;
 	char **environ;
@@ -88,10 +839,115 @@ typedef struct passinfo
 	int env_changed;
 	int readfd;
 	int historycount;
+	char **assignv;
+	int assigns;
+	func_t **funcs;
+	char **posv;
+	int posc;
+	int depth;
+	int unwind;
+	unsigned int input_line;
+	int loops;
+	int levels;
+	prog_t *script;
+	int cache_hits;
+	int cache_misses;
+	srcfile_t *sources;
+	int sourced;
+	globdir_t *globdirs;
+	pattern_t **patterns;
+	int npatterns;
+	struct procsub *procsubs;
+	unsigned int fds;
+	int keepfds;
+	int nofork;
+	coproc_t *coprocs;
+	readahead_t *readahead;
+	int peek[2];
+	pid_t peekpid;
+	getopts_t *getopts;
+	condregex_t *regexes;
+	timeout_t *timeout;
 } info_t;
 
-#define INFO_INIT {NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
-	NULL, NULL, NULL, NULL, NULL, 0, 0, NULL, 0, 0, 0}
+#define INFO_INIT {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+	0, 0, 0, 0, 0, 0, 0, 0, 0, NULL, 0, NULL, NULL, 0, 0, 0, 0, 0, 0, \
+	NULL, 0, 0, NULL, 0, NULL, NULL, 0, NULL, 0, 0, 0, NULL, NULL, {0, 0}, \
+	0, NULL, NULL, NULL}
+
+/**
+ * struct filter - The input and output of a line filter builtin
+ * @info: The parameter struct, for messages
+ * @fd: The input descriptor, -1 when none is open
+ * @name: The input as named on the command line, "-" for standard input
+ * @in: The input read so far
+ * @pos: The offset in @in of the first byte not used yet
+ * @eof: Set once the input is at its end
+ * @failed: Set once an input could not be opened or read
+ * @out: The output not written yet
+ * @err: The errno of a failed write, 0 while writing works
+ * @banners: The number of "==> name <==" headings written
+ */
+typedef struct filter
+{
+	info_t *info;
+	int fd;
+	char *name;
+	strbuf_t in;
+	size_t pos;
+	int eof;
+	int failed;
+	strbuf_t out;
+	int err;
+	int banners;
+} filter_t;
+
+/**
+ * struct grep - A pattern and the options of a grep command
+ * @pat: The pattern
+ * @len: The length of @pat
+ * @re: @pat compiled, unless @fixed is set
+ * @fixed: Set when @pat has no special characters and is found with
+ *         memmem()
+ * @invert: Set to select the lines not matching (-v)
+ * @count: Set to write only the number of lines selected (-c)
+ * @quiet: Set to write nothing and stop at the first line selected (-q)
+ * @number: Set to write the line number before each line (-n)
+ * @lineno: The number of the line being looked at
+ * @matches: The number of lines selected
+ */
+typedef struct grep
+{
+	char *pat;
+	size_t len;
+	regex_t re;
+	int fixed;
+	int invert;
+	int count;
+	int quiet;
+	int number;
+	long lineno;
+	long matches;
+} grep_t;
+
+/**
+ * struct cut - The parts of each line a cut command keeps
+ * @sel: For each field or byte number below @nsel, 1 if it is kept
+ * @nsel: The size of @sel
+ * @from: Every number from this one on is kept, LONG_MAX if none is
+ * @fields: Set when the list numbers fields (-f), not bytes
+ * @delim: The byte separating fields (-d)
+ * @only: Set to drop lines without a delimiter (-s)
+ */
+typedef struct cut
+{
+	char *sel;
+	long nsel;
+	long from;
+	int fields;
+	char delim;
+	int only;
+} cut_t;
 
 /**
  *struct builtin - stores a built-in command string and its function pointer.
@@ -127,8 +983,6 @@ int renumberHist(info_t *info);
 int read_histFile(info_t *info);
 char *retrieve_histFile(info_t *info);
 
-void lookFor_chain(info_t *, char *, size_t *, size_t, size_t);
-int isChainDelimiter(info_t *, char *, size_t *);
 int replaceAlias(info_t *);
 int sub_strn(char **, char *);
 int replaceVariables(info_t *);
@@ -166,7 +1020,7 @@ void handle_sign(int);
 ssize_t inputGet(info_t *);
 int get_line(info_t *, char **, size_t *);
 
-int search_builtin(info_t *);
+int (*builtin_find(char *))(info_t *);
 int hash(info_t *, char **);
 void forkExe_command(info_t *);
 void find_command(info_t *);
@@ -182,10 +1036,11 @@ int memfree(void **);
 int alias_cmd(info_t *);
 int hist_cmd(info_t *);
 
-char **getEnviron(info_t *);
-int _mysetenv(info_t *, char *, char *);
-int _myunsetenv(info_t *, char *);
+char **get_environ(info_t *);
+int set_env(info_t *, char *, char *);
+int unset_env(info_t *, char *);
 
+char *join_path(char *, char *);
 char *lookFor_path(info_t *, char *, char *);
 char *dup_chars(char *, int, int);
 int cmd_exists(info_t *, char *);
@@ -204,4 +1059,413 @@ int setenv_cmd(info_t *);
 int unsetenv_cmd(info_t *);
 int populateEnv_list(info_t *);
 
+unsigned int var_hash(const char *, size_t);
+symtab_t *symtab_new(symtab_t *, size_t);
+symtab_t *symtab_free(symtab_t *);
+int symtab_grow(symtab_t *);
+var_t *symtab_insert(symtab_t *, const char *, size_t, const char *, int);
+
+char *var_pair(const char *, size_t, const char *);
+var_t *var_find(symtab_t *, const char *, size_t, unsigned int);
+var_t *var_lookup(info_t *, const char *, size_t);
+var_t *var_set(info_t *, const char *, size_t, const char *, int);
+int var_unset(info_t *, const char *, size_t);
+
+char *var_value(info_t *, const char *, size_t);
+var_t *var_local(info_t *, const char *, size_t, const char *, int);
+int scope_push(info_t *);
+void scope_pop(info_t *);
+char **build_envp(info_t *);
+
+int declare_names(info_t *, int, int);
+int export_cmd(info_t *);
+int readonly_cmd(info_t *);
+int local_cmd(info_t *);
+int unset_cmd(info_t *);
+
+size_t print_vars(info_t *, int, char *);
+
+size_t var_name_len(const char *);
+size_t assign_len(const char *);
+int split_assignments(info_t *);
+int run_assignments(info_t *);
+int assign_is_compound(const char *);
+
+int overlay_match(info_t *, char *);
+char **overlay_envp(info_t *, char **);
+int overlay_push(info_t *);
+
+int sb_grow(strbuf_t *, size_t);
+int sb_add(strbuf_t *, const char *, size_t);
+int sb_addc(strbuf_t *, char);
+char *sb_take(strbuf_t *);
+int wl_push(wordlist_t *, char *);
+
+size_t expand_param(info_t *, char *, strbuf_t *, wordlist_t *, int *, int);
+size_t expand_word(info_t *, char *, wordlist_t *, int);
+int expand_vector(info_t *, char ***, int);
+char *expand_string(info_t *, const char *, size_t);
+
+int expand_braced(info_t *, char *, size_t, strbuf_t *, wordlist_t *, int *,
+		int);
+void expand_multi(char **, strbuf_t *, wordlist_t *, int *);
+char *subscript_value(info_t *, var_t *, char *, size_t);
+char **var_list(var_t *, int);
+int expand_trim(info_t *, char *, size_t, strbuf_t *, wordlist_t *, int *,
+		int);
+
+void special_param(info_t *, char *, size_t, strbuf_t *, wordlist_t *, int *,
+		int);
+void expand_fields(info_t *, char **, strbuf_t *, wordlist_t *, int *, int);
+void expand_split(info_t *, char *, strbuf_t *, wordlist_t *, int *);
+size_t expand_tilde(info_t *, char *, strbuf_t *, int *);
+int param_is_multi(const char *, size_t);
+
+array_t *array_new(int);
+void array_free(array_t *);
+int array_sparsify(array_t *);
+arrentry_t *array_sparse_slot(array_t *, long, int);
+int array_index_set(array_t *, long, char *);
+
+arrentry_t *array_assoc_slot(array_t *, const char *, int);
+int array_assoc_grow(array_t *);
+int array_assoc_set(array_t *, const char *, char *);
+void array_unset(array_t *, const char *, long);
+char *array_get(array_t *, const char *, long);
+
+long array_end(array_t *);
+int array_set(array_t *, const char *, long, char *);
+int array_append(array_t *, char *);
+char **array_list(array_t *, int);
+long array_index(info_t *, char *);
+
+var_t *array_var(info_t *, const char *, size_t, int, int);
+int assign_word(info_t *, char *, int);
+int assign_compound(info_t *, var_t *, char *, int);
+int assign_element(info_t *, var_t *, char *, int);
+int assign_append(info_t *, char *, size_t, char *, int);
+
+int declare_cmd(info_t *);
+int declare_flags(info_t *, int *, int *);
+
+int mapfile_cmd(info_t *);
+char *mapfile_slurp(int, size_t *);
+int mapfile_split(array_t *, char *, size_t, int, long);
+
+int lex_next(lexer_t *);
+int lex_word(lexer_t *);
+int lex_quoted(lexer_t *, strbuf_t *);
+size_t lex_meta(const char *);
+char **lex_words(char *);
+
+char *lex_heredoc(lexer_t *, const char *, int, int);
+char *lex_delim(const char *);
+int lex_ionum(lexer_t *);
+
+int parse_program(info_t *, char *, int, node_t **);
+node_t *parse_list(lexer_t *);
+node_t *parse_and_or(lexer_t *);
+node_t *parse_pipeline(lexer_t *);
+node_t *parse_command(lexer_t *);
+
+node_t *parse_simple(lexer_t *);
+node_t *parse_group(lexer_t *);
+node_t *parse_funcdef(lexer_t *, char *);
+node_t *parse_fail(lexer_t *);
+int parse_closer(lexer_t *);
+
+node_t *parse_if(lexer_t *);
+node_t *parse_loop(lexer_t *);
+node_t *parse_do(lexer_t *, node_t *);
+node_t *parse_for(lexer_t *);
+node_t *parse_case(lexer_t *);
+
+node_t *parse_compound(lexer_t *);
+node_t *parse_arm(lexer_t *);
+int parse_redir(lexer_t *, wordlist_t *);
+node_t *parse_subshell(lexer_t *);
+node_t *parse_redirs(lexer_t *, node_t *);
+
+node_t *parse_stages(lexer_t *, node_t *);
+node_t *parse_cond(lexer_t *);
+int parse_regex(lexer_t *, wordlist_t *);
+
+prog_t *prog_new(void);
+void prog_free(prog_t *);
+int prog_emit(prog_t *, int, int, int);
+int prog_cmd(prog_t *, char **, int);
+prog_t *compile_program(node_t *);
+
+void compile_list(prog_t *, node_t *);
+void compile_node(prog_t *, node_t *);
+void compile_if(prog_t *, node_t *);
+void compile_loop(prog_t *, node_t *);
+void compile_pipe(prog_t *, node_t *);
+
+void compile_case(prog_t *, node_t *);
+char **for_words(node_t *);
+void compile_redir(prog_t *, node_t *);
+void compile_subshell(prog_t *, node_t *);
+
+int vm_run(info_t *, prog_t *);
+void vm_simple(info_t *, cmd_t *);
+int vm_loop(info_t *, prog_t *, int, loop_t *, int *);
+int vm_unwind(info_t *, loop_t *, int *, int *);
+void vm_pop(info_t *, loop_t *, int *);
+
+void vm_for(info_t *, loop_t *, char **);
+int vm_next(info_t *, loop_t *, char *);
+
+int vm_group(info_t *, prog_t *, int, redirframe_t **, int);
+void vm_unredir(info_t *, redirframe_t **);
+void vm_subshell(info_t *, cmd_t *);
+void subshell_exit(info_t *);
+
+void vm_pipe(info_t *, cmd_t *, int);
+void pipe_choose(info_t *, cmd_t *, int, int *, int *);
+pid_t pipe_spawn(info_t *, cmd_t *, int *, int, int);
+void pipe_local(info_t *, cmd_t *, int, int, int *);
+int pipe_inproc(info_t *, cmd_t *);
+
+void pipe_wait(info_t *, pid_t *, int);
+
+char *expand_pattern(info_t *, char *, int);
+void pattern_add(strbuf_t *, const char *, size_t, int);
+int pattern_match(info_t *, const char *, const char *);
+int case_match(info_t *, char *, char **);
+
+pattern_t *pattern_compile(const char *, int);
+int pattern_next(const char **, unsigned char *);
+size_t pattern_class(const char *, unsigned char *);
+size_t pattern_posix(const char *, unsigned char *);
+long pattern_span(pattern_t *, const char *, size_t, int);
+
+pattern_t *pattern_get(info_t *, const char *, int);
+void pattern_free(pattern_t *);
+void patterns_free(info_t *);
+
+prog_t *script_cache(info_t *, int);
+prog_t *script_compile(info_t *, const char *, size_t);
+char *cache_path(info_t *, struct stat *);
+prog_t *cache_load(char *, cachehdr_t *);
+void cache_store(char *, cachehdr_t *, prog_t *);
+
+int prog_save(strbuf_t *, prog_t *);
+prog_t *prog_load(cachereader_t *);
+int load_cmd(cachereader_t *, cmd_t *);
+int load_bytes(cachereader_t *, void *, size_t);
+char *load_string(cachereader_t *);
+
+int prog_check(prog_t *);
+void cache_count(info_t *, int);
+char **load_words(cachereader_t *, int);
+int pipe_check(cmd_t *, int);
+
+size_t glob_word(info_t *, char *, wordlist_t *);
+void glob_walk(info_t *, strbuf_t *, char *, wordlist_t *);
+globdir_t *glob_dir(info_t *, char *);
+int glob_cmp(const void *, const void *);
+void globdirs_free(info_t *);
+
+size_t glob_fields(info_t *, char *, wordlist_t *);
+size_t glob_expand(info_t *, char *, wordlist_t *);
+int glob_has_meta(const char *);
+void glob_unescape(char *);
+
+void glob_tree(info_t *, strbuf_t *, char *, wordlist_t *);
+int glob_threads(info_t *);
+void glob_spawn(globtree_t *, int, int, char *);
+
+void *glob_worker(void *);
+int glob_take(globworker_t *, globtask_t *);
+void glob_push(globworker_t *, int, char *);
+void glob_visit(globworker_t *, int, char *);
+int glob_isdir(int, struct dirent *);
+
+brace_t *brace_parse(const char *, size_t, int *);
+size_t brace_close(const char *, size_t, int *);
+brace_t *brace_list(const char *, size_t, int *);
+brace_t *brace_seq(const char *, size_t);
+int brace_num(const char *, long *);
+
+unsigned long brace_stride(brace_t *);
+unsigned long brace_total(brace_t *);
+void brace_nth(brace_t *, unsigned long, strbuf_t *);
+brace_t *brace_lazy(const char *);
+void brace_free(brace_t *);
+
+size_t brace_skip(const char *, size_t);
+brace_t **brace_text(brace_t **, const char *, size_t, int *);
+
+int batch_cmd(info_t *);
+char *batch_find(info_t *, char *);
+size_t batch_room(info_t *, char **, char *);
+int batch_run(info_t *, char *, char **, int);
+pid_t batch_spawn(info_t *, char *, char **, char **);
+
+int batch_wait(pid_t);
+
+int redir_apply(info_t *, char **, int *);
+void redir_restore(int *);
+int redir_open(info_t *, char *);
+char *heredoc_expand(info_t *, const char *);
+
+int exec_cmd(info_t *);
+int redir_file(info_t *, char *);
+void redir_done(info_t *, int *);
+void redir_keep(info_t *, int *);
+
+int cat_cmd(info_t *);
+int cat_file(info_t *, char *);
+int cp_cmd(info_t *);
+int cp_file(info_t *, char *, char *, int);
+char *cp_target(char *, char *);
+
+int sleep_cmd(info_t *);
+int sleep_parse(char *, double *);
+int sleep_timer(double);
+int sleep_wait(int, int);
+int waitfor_cmd(info_t *);
+
+int waitfor_watch(info_t *, char *, int, int *);
+int waitfor_event(int, char *);
+
+int timeout_cmd(info_t *);
+int timeout_opts(info_t *, timeout_t *);
+int timeout_signal(char *);
+void timeout_spawn(info_t *, timeout_t *);
+void timeout_wait(info_t *, pid_t);
+
+int ulimit_cmd(info_t *);
+ulimit_t *ulimit_find(char);
+int ulimit_show(info_t *, ulimit_t *, int, int);
+int ulimit_set(info_t *, ulimit_t *, char *, int);
+
+void filter_init(info_t *, filter_t *);
+int filter_open(filter_t *, char *);
+void filter_close(filter_t *);
+ssize_t filter_fill(filter_t *);
+int filter_line(filter_t *, char **, size_t *);
+
+int filter_put(filter_t *, const char *, size_t);
+int filter_flush(filter_t *);
+int filter_end(filter_t *, int);
+void filter_banner(filter_t *, char *);
+long filter_lines(const char *, size_t);
+
+int head_cmd(info_t *);
+int head_opts(info_t *, long *, int *, int *);
+void head_file(filter_t *, long, int, int);
+int tail_cmd(info_t *);
+void tail_file(filter_t *, long, int, int);
+
+void tail_seek(filter_t *, struct stat *, long, int);
+size_t tail_start(filter_t *, long, int);
+void tail_rest(filter_t *);
+
+int grep_cmd(info_t *);
+int grep_opts(info_t *, grep_t *);
+void grep_file(filter_t *, grep_t *);
+void grep_fixed(filter_t *, grep_t *);
+void grep_select(filter_t *, grep_t *, char *, size_t);
+
+int wc_cmd(info_t *);
+void wc_file(filter_t *, long *, int);
+int wc_width(info_t *, int, int);
+void wc_print(filter_t *, long *, int, int, char *);
+
+int cut_cmd(info_t *);
+int cut_opts(info_t *, cut_t *);
+int cut_list(cut_t *, char *);
+void cut_line(filter_t *, cut_t *, char *, size_t);
+int cut_kept(cut_t *, long);
+
+int copy_fd(int, int);
+ssize_t copy_kernel(int, int, int);
+int copy_rw(int, int);
+
+int coproc_cmd(info_t *);
+int coproc_isname(info_t *, char *);
+pid_t coproc_spawn(info_t *, char **, int *);
+int coproc_vars(info_t *, coproc_t *);
+void coproc_reap(info_t *);
+
+int coproc_owns(info_t *, long);
+int coproc_close(info_t *, long);
+int redir_named(info_t *, char *);
+
+int read_cmd(info_t *);
+int read_opts(info_t *, readopts_t *);
+int read_assign(info_t *, strbuf_t *, int, char **);
+size_t read_field(const char *, const char *, size_t, size_t *,
+		const char *);
+int read_sep(const char *, const char *, size_t, const char *);
+
+int read_input(info_t *, readopts_t *, strbuf_t *);
+int read_file(info_t *, readopts_t *, strbuf_t *, struct stat *);
+int read_pipe(info_t *, readopts_t *, strbuf_t *);
+int read_bytes(readopts_t *, strbuf_t *);
+int read_wait(readopts_t *);
+
+readahead_t *readahead_get(info_t *, int, struct stat *);
+void readahead_free(info_t *);
+int read_peek(info_t *);
+char *read_unescape(strbuf_t *);
+long read_now(void);
+
+void cond_run(info_t *, cmd_t *);
+int cond_or(info_t *, char **, int *, int);
+int cond_and(info_t *, char **, int *, int);
+int cond_not(info_t *, char **, int *, int);
+int cond_primary(info_t *, char **, int *, int);
+
+char *cond_word(info_t *, char *);
+int cond_unary(info_t *, char, char *);
+int cond_binary(info_t *, char *, int, char *);
+int cond_compare(info_t *, char *, char *, int);
+int cond_files(char *, char *, int);
+
+int cond_binop(char *);
+int cond_regex(info_t *, char *, char *);
+void cond_rematch(info_t *, char *, regmatch_t *, size_t);
+condregex_t *regex_get(info_t *, const char *);
+void regexes_free(condregex_t **);
+
+int getopts_cmd(info_t *);
+getopts_t *getopts_table(info_t *, char *);
+void getopts_next(info_t *, getopts_t *, char **, int);
+void getopts_set(info_t *, getopts_t *, char, char *);
+void getopts_free(info_t *);
+
+int redir_feed(const char *, size_t);
+int redir_writer(const char *, size_t);
+int redir_write(int, const char *, size_t);
+
+size_t procsub_expand(info_t *, char *, strbuf_t *);
+int procsub_open(info_t *, char *, int);
+void procsub_run(info_t *, char *);
+void procsub_reap(info_t *);
+
+int source_cmd(info_t *);
+char *source_find(info_t *, char *);
+prog_t *source_load(info_t *, char *);
+srcfile_t *source_entry(info_t *, char *);
+void sources_free(info_t *);
+
+node_t *node_new(int, int);
+void node_free(node_t *);
+int lex_is(lexer_t *, const char *);
+int read_command(info_t *, node_t **);
+
+void exec_command(info_t *, int (*)(info_t *));
+int run_builtin(info_t *, int (*)(info_t *));
+int func_call(info_t *, func_t *);
+int break_cmd(info_t *);
+
+func_t *func_find(info_t *, char *);
+int func_define(info_t *, char *, prog_t *);
+int func_unset(info_t *, char *);
+void funcs_free(info_t *);
+int return_cmd(info_t *);
+
 #endif /* MY_SHELL_H */
@@ -1,41 +1,36 @@
 #include "myshell.h"
 
 /**
- * infoSet - Initialize an info_t struct with relevant information.
- * This function initializes the info_t struct with data extracted from the
- * provided argument vector (av). It sets the program name, parses the argument
- * string (if available), and calculates the number of arguments (argc).
- * Additionally, it performs operations to replace aliases and variables.
+ * infoSet - Initialize an info_t struct for running one simple command.
+ * This function copies the words of a parsed simple command into the
+ * argument vector (argv) and calculates the number of arguments (argc).
+ * Additionally, it splits leading NAME=value assignment words off 'argv'
+ * and performs operations to replace aliases and variables.
  * @info: Pointer to the info_t struct to initialize
- * @av: Argument vector (command-line arguments).
+ * @words: The command's words as parsed, quotes included.
  */
-void infoSet(info_t *info, char **av)
+void infoSet(info_t *info, char **words)
 {
 	int a = 0; /* Initialize 'a' outside of the loop */
 
-	info->fname = av[0]; /* Set the program name from the argument vector */
-	if (info->arg)
-	{/* Parse the argument string into an argument vector */
-	info->argv = splitString(info->arg, " \t");
-		if (!info->argv)
-		{
-			/* Handle memory allocation failure by creating a minimal argv */
-			info->argv = malloc(sizeof(char *) * 2);
-			if (info->argv)
-			{
-				info->argv[0] = dupStrn(info->arg);
-				info->argv[1] = NULL;
-			}
-		}
-		/* Calculate the number of arguments (argc) */
-		for (a = 0; info->argv && info->argv[a]; a++)
-			;
-		info->argc = a;
+	for (a = 0; words && words[a]; a++)
+		;
+	/* Copy the words; the parsed tree is kept for the next run */
+	info->argv = malloc(sizeof(char *) * (a + 1));
+	if (!info->argv)
+		return;
+	for (a = 0; words && words[a]; a++)
+		info->argv[a] = dupStrn(words[a]);
+	info->argv[a] = NULL;
+	/* Set the number of arguments (argc) */
+	info->argc = a;
 
-		/* Replace aliases and variables in the argument vector */
+	/* Leading NAME=value words are assignments, not the command name */
+	split_assignments(info);
+	if (info->argc)
 		replaceAlias(info);
-		replaceVariables(info);
-	}
+	/* Replace variables in the argument vector */
+	replaceVariables(info);
 }
 /**
  * infoClear-  Reset fields within an info_t struct.
@@ -51,8 +46,9 @@ void infoClear(info_t *info)
 	info->argv = NULL;
 	/* Reset the path field */
 	info->path = NULL;
-	/* Reset the argument count (argc) to 0 */
+	/* Reset the argument and assignment counts to 0 */
 	info->argc = 0;
+	info->assigns = 0;
 }
 /**
  * infoFree - Free fields within an info_t struct.
@@ -67,17 +63,30 @@ void infoFree(info_t *info, int all)
 	/* Free memory allocated for 'argv' */
 	free_strn(info->argv);
 	info->argv = NULL;
+	free_strn(info->assignv);
+	info->assignv = NULL;
 	info->path = NULL;
+	/* Directory listings only last for the command they were made for */
+	globdirs_free(info);
 
 	if (all)/* If 'all' flag is true */
 	{/* If 'cmd_buffs' is not allocated */
 	if (!info->cmd_buffer)
 	/* Free memory allocated for 'arg' */
 	free(info->arg);
-	/* If 'env' is allocated */
-	if (info->env)
-	 /* Free memory for 'env' linked list */
-	freeList(&(info->env));
+	/* Free every variable scope down to the globals */
+	while (info->vars)
+	info->vars = symtab_free(info->vars);
+	/* Free the function table and the stored function bodies */
+	funcs_free(info);
+	/* Free the compiled script and the files kept by 'source' */
+	prog_free(info->script);
+	info->script = NULL;
+	sources_free(info);
+	patterns_free(info);
+	readahead_free(info);
+	getopts_free(info);
+	regexes_free(&info->regexes);
 	/* If 'history' is allocated */
 	if (info->history)
 	/* Free memory for 'history' linked list */
@@ -86,8 +95,8 @@ void infoFree(info_t *info, int all)
 	if (info->alias)
 	 /* Free memory for 'alias' linked list */
 	freeList(&(info->alias));
-	/* Free memory allocated for 'environ' */
-	free_strn(info->environ);
+	/* Free the envp array; its strings belong to the variables */
+	free(info->environ);
 	 /* Set 'environ' to NULL */
 	info->environ = NULL;
 	/* Free memory allocated for 'cmd_buffs' array */
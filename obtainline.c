@@ -18,12 +18,12 @@ void handle_sign(__attribute__((unused)) int sig_num)
 }
 
 /**
- * input_buf - Buffer chained commands and read input.
+ * input_buf - Read one line of input into a buffer.
  * @info: Parameter struct containing information about the input.
  * @buff: Pointer to the buffer for storing input data.
  * @len: Pointer to the length of the data in the buffer.
- * This function is responsible for buffering chained commands and reading
- * input from the standard input (stdin) into the provided buffer (buff).
+ * This function reads the next line from the input file descriptor into
+ * the provided buffer (buff), counts it and adds it to the history.
  * It updates the 'buff' and 'len' pointers to store the read data.
  *
  * Return: The number of bytes read, or 0 if the buffer is not empty,
@@ -58,15 +58,12 @@ ssize_t input_buf(info_t *info, char **buff, size_t *len)
 				(*buff)[a - 1] = '\0'; /* remove trailing newline */
 				a--;
 			}
-			/* Set the linecount_flag and process the input */
+			/* Count the line and add it to the history */
 			info->linecount_flag = 1;
-			remv_comnt(*buff);
+			info->input_line++;
 			build_histList(info, *buff, info->historycount++);
-			/* Check if this is a command chain (';'-separated commands) */
-			{
-				*len = a;
-				info->cmd_buffer = buff;
-			}
+			*len = a;
+			info->cmd_buffer = buff;
 		}
 	}
 	/* Return the number of bytes read (a) or -1 on error */
@@ -77,49 +74,24 @@ ssize_t input_buf(info_t *info, char **buff, size_t *len)
  * inputGet - Read a line of input, excluding the newline character.
  * @info: Parameter struct containing input information.
  *
- * Return: The number of bytes read.
+ * Comments, quotes and the ';', '&&' and '||' operators are left for
+ * the parser; the whole line is passed back in info->arg.
+ *
+ * Return: The number of bytes read, or -1 at the end of the input.
  */
 ssize_t inputGet(info_t *info)
 {
 	ssize_t a = 0;
-	static size_t b;
-	static size_t j;
-	static size_t c;
-	char **buff_p = &(info->arg), *p;
-	static size_t len;
-	static char *buff; /* the ';' command chain buffer */
+	size_t len = 0;
+	static char *buff; /* the line buffer, freed by infoFree() */
 
 	wrt_chr(BUFFER_FLUSH);
 	/* Read input into the buffer and track the number of bytes read */
 	a = input_buf(info, &buff, &len);
 	if (a == -1) /* EOF */
 		return (-1);
-	if (len) /* we have commands left in the chain buffer */
-	{
-		c = b; /* init new iterator to current buf position */
-		p = buff + b; /* get pointer for return */
-
-		lookFor_chain(info, buff, &j, b, len);
-		while (c < len) /* iterate to semicolon or end */
-		{
-			if (isChainDelimiter(info, buff, &c))
-				break;
-			c++;
-		}
-
-		b = c + 1; /* increment past nulled ';'' */
-		if (b >= len) /* reached end of buffer? */
-		{
-			b = len = 0; /* reset position and length */
-			info->cmd_buffer_type = CMND_NORM;
-		}
-
-		*buff_p = p; /* pass back pointer to current command position */
-		return (lenstrn(p)); /* return length of current command */
-	}
-
-	*buff_p = buff; /* else not a chain, pass back buffer from _getline() */
-	return (a); /* return length of buffer from _getline() */
+	info->arg = buff;
+	return (a);
 }
 
 /**
@@ -153,46 +125,45 @@ ssize_t read_buf(info_t *info, char *buf, size_t *i)
 /**
  * get_line - gets the next line of input from STDIN
  * @info: parameter struct
- * @ptr: address of pointer to buffer, preallocated or NULL
- * @length: size of preallocated ptr buffer if not NULL
+ * @ptr: address of pointer to buffer; any old buffer is freed
+ * @length: receives the length of the line if not NULL
+ *
+ * Reads are repeated until a newline or the end of the input, so a line
+ * longer than the read buffer is returned whole.
  *
- * Return: s
+ * Return: the length of the line, or -1 at the end of the input
  */
 int get_line(info_t *info, char **ptr, size_t *length)
 {
 	static size_t a; /* Static position indicator */
-	ssize_t b = 0;    /* read status variables */
-	ssize_t s = 0;    /* Size status variables */
-	size_t c;         /* Temporary size variable */
-	char *p = NULL;   /* Input pointer */
-	char *new_p = NULL; /* New pointer for reallocation */
-	char *pnl;       /* Pointer to newline character */
 	static size_t leng; /* Length of the read buffer */
 	static char buff[READ_BUFFER_SIZE]; /* Read buffer */
+	strbuf_t sb = {NULL, 0, 0}; /* The line being assembled */
+	ssize_t b = 0;    /* read status variables */
+	size_t c;         /* End of the part of buff used */
+	char *pnl = NULL; /* Pointer to newline character */
 
-	p = *ptr; /* Set input pointer */
-	if (p && length)
-		s = *length; /* Update length if provided */
-	if (a == leng)
-		a = leng = 0; /* Reset position indicators */
-	b = read_buf(info, buff, &leng); /* Read data */
-	if (b == -1 || (b == 0 && leng == 0))
-		return (-1); /* Check for errors */
-	pnl = str_chr(buff + a, '\n'); /* Find newline */
-	c = pnl ? 1 + (unsigned int)(pnl - buff) : leng; /* Calculate size */
-	new_p = realloc_mem(p, s, s ? s + c : c + 1); /* Reallocate memory */
-	if (!new_p)
-		return (p ? free(p), -1 : -1); /* Check memory allocation */
-	if (s)
-		strncat(new_p, buff + a, c - a); /* Concatenate strings */
-	else
-		strncpy(new_p, buff + a, c - a + 1); /* Copy strings */
-	s += c - a; /* Update size */
-	a = c; /* Update position */
-	p = new_p; /* Update pointer */
+	while (!pnl)
+	{
+		if (a == leng)
+			a = leng = 0; /* Reset position indicators */
+		b = read_buf(info, buff, &leng); /* Read data */
+		if (b == -1 || (b == 0 && leng == 0))
+			break; /* End of input (or error) */
+		pnl = memchr(buff + a, '\n', leng - a); /* Find newline */
+		c = pnl ? 1 + (size_t)(pnl - buff) : leng; /* Calculate size */
+		if (sb_add(&sb, buff + a, c - a) == -1)
+			break;
+		a = c; /* Update position */
+	}
+	if (!sb.len)
+	{
+		free(sb.s);
+		return (-1);
+	}
+	free(*ptr);
+	*ptr = sb.s; /* Update pointer */
 	if (length)
-		*length = s; /* Update length if provided */
-	*ptr = p; /* Update pointer */
-
-	return (s); /* Return the size */
+		*length = sb.len; /* Update length if provided */
+	return (sb.len); /* Return the size */
 }
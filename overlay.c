@@ -0,0 +1,79 @@
+#include "myshell.h"
+
+/**
+ * overlay_match - Checks whether a prefix assignment overrides an
+ *                 environment entry.
+ * @info: The parameter struct holding 'assignv'.
+ * @entry: A "NAME=value" environment entry.
+ *
+ * Return: 1 if some 'assignv' word sets the same NAME, 0 otherwise.
+ */
+int overlay_match(info_t *info, char *entry)
+{
+	size_t n;
+	int a;
+
+	for (a = 0; a < info->assigns; a++)
+	{
+		n = var_name_len(info->assignv[a]);
+		if (!strncmp(entry, info->assignv[a], n + 1))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * overlay_envp - Lays a command's NAME=value prefix assignments over the
+ *                exported environment.
+ * @info: The parameter struct holding 'assignv'.
+ * @envp: The shell's exported envp from get_environ().
+ *
+ * This runs in the child right before execve(). The new array points at
+ * the strings of @envp and of 'assignv', so no string is copied and the
+ * shell's own variables are never touched.
+ *
+ * Return: The overlaid envp, or @envp itself if allocation fails.
+ */
+char **overlay_envp(info_t *info, char **envp)
+{
+	size_t a, n;
+	char **out;
+
+	for (n = 0; envp && envp[n]; n++)
+		;
+	out = malloc(sizeof(char *) * (n + info->assigns + 1));
+	if (!out)
+		return (envp);
+	for (a = n = 0; envp && envp[a]; a++)
+		if (!overlay_match(info, envp[a]))
+			out[n++] = envp[a];
+	for (a = 0; a < (size_t)info->assigns; a++)
+		out[n++] = info->assignv[a];
+	out[n] = NULL;
+	return (out);
+}
+
+/**
+ * overlay_push - Makes a builtin see its prefix assignments.
+ * @info: The parameter struct holding 'assignv'.
+ *
+ * The assignments become exported variables of a temporary scope that the
+ * caller drops with scope_pop() once the builtin returns.
+ *
+ * Return: 0 on success, -1 if the scope cannot be allocated.
+ */
+int overlay_push(info_t *info)
+{
+	size_t n;
+	int a;
+
+	if (scope_push(info))
+		return (-1);
+	for (a = 0; a < info->assigns; a++)
+	{
+		n = var_name_len(info->assignv[a]);
+		var_local(info, info->assignv[a], n, info->assignv[a] + n + 1,
+				VAR_EXPORT);
+	}
+	return (0);
+}
@@ -0,0 +1,178 @@
+#include "myshell.h"
+
+/**
+ * parse_program - Parses a block of input into a command tree.
+ * @info: The parameter struct; used for the file name in error messages,
+ *        which are left out while it is unset.
+ * @text: The input, one or more complete lines.
+ * @line: The input line number @text starts on.
+ * @tree: Receives the parsed list, or NULL on error or empty input.
+ *
+ * A syntax error is reported on stderr. Running out of input in the
+ * middle of a construct (an open quote, a trailing && or an unclosed
+ * group) is not an error: the caller should append another line and
+ * parse again.
+ *
+ * Return: PARSE_OK, PARSE_MORE or PARSE_ERROR.
+ */
+int parse_program(info_t *info, char *text, int line, node_t **tree)
+{
+	lexer_t lx;
+
+	memset(&lx, 0, sizeof(lx));
+	lx.src = text;
+	lx.line = line;
+	lex_next(&lx);
+	*tree = parse_list(&lx);
+	if (!lx.status && lx.tok != TOK_EOF)
+		parse_fail(&lx);
+	if (lx.status == PARSE_ERROR && info->fname)
+		fprintf(stderr, "%s: %d: Syntax error: \"%s\" unexpected\n",
+				info->fname, lx.line, lx.text);
+	free(lx.word);
+	if (lx.status)
+	{
+		node_free(*tree);
+		*tree = NULL;
+	}
+	return (lx.status);
+}
+
+/**
+ * parse_list - Parses and-or lists separated by ';' or newlines.
+ * @lx: The lexer.
+ *
+ * The list ends at the end of the input or at a token that closes an
+ * enclosing construct, such as '}' or ')'.
+ *
+ * Return: The first command of the list (the rest follow through 'next'),
+ *         or NULL if the list is empty or on error (see lx->status).
+ */
+node_t *parse_list(lexer_t *lx)
+{
+	node_t *head = NULL, **tail = &head;
+
+	while (!lx->status)
+	{
+		while (lx->tok == TOK_NEWLINE)
+			lex_next(lx);
+		if (parse_closer(lx))
+			break;
+		*tail = parse_and_or(lx);
+		if (!*tail)
+			break;
+		tail = &(*tail)->next;
+		if (lx->tok != TOK_SEMI && lx->tok != TOK_NEWLINE)
+			break;
+		lex_next(lx);
+	}
+	if (lx->status)
+	{
+		node_free(head);
+		return (NULL);
+	}
+	return (head);
+}
+
+/**
+ * parse_and_or - Parses pipelines joined by && and ||.
+ * @lx: The lexer.
+ *
+ * Both operators have equal precedence and group to the left, so
+ * "a || b && c" runs c after either a or b succeeded.
+ *
+ * Return: The tree of the list, or NULL on error.
+ */
+node_t *parse_and_or(lexer_t *lx)
+{
+	node_t *left = parse_pipeline(lx), *n;
+
+	while (left && (lx->tok == TOK_AND_IF || lx->tok == TOK_OR_IF))
+	{
+		n = node_new(lx->tok == TOK_AND_IF ? NODE_AND : NODE_OR, lx->line);
+		if (!n)
+			break;
+		n->left = left;
+		left = n;
+		do {
+			lex_next(lx);
+		} while (lx->tok == TOK_NEWLINE);
+		n->right = parse_pipeline(lx);
+		if (!n->right)
+			break;
+	}
+	if (lx->status)
+	{
+		node_free(left);
+		return (NULL);
+	}
+	return (left);
+}
+
+/**
+ * parse_pipeline - Parses a pipeline, optionally negated with '!'.
+ * @lx: The lexer.
+ *
+ * A newline may follow each '|'.
+ *
+ * Return: The tree of the pipeline, or NULL on error.
+ */
+node_t *parse_pipeline(lexer_t *lx)
+{
+	node_t *n = NULL, **cmd = &n;
+
+	if (lex_is(lx, "!"))
+	{
+		n = node_new(NODE_NOT, lx->line);
+		if (!n)
+			return (NULL);
+		lex_next(lx);
+		cmd = &n->left;
+	}
+	*cmd = parse_command(lx);
+	if (*cmd && lx->tok == TOK_PIPE)
+		*cmd = parse_stages(lx, *cmd);
+	if (lx->status || !*cmd)
+	{
+		node_free(n);
+		return (NULL);
+	}
+	return (n);
+}
+
+/**
+ * parse_command - Parses one simple command, compound command or function
+ *                 definition.
+ * @lx: The lexer.
+ *
+ * Return: The tree of the command, or NULL on error.
+ */
+node_t *parse_command(lexer_t *lx)
+{
+	char *name;
+	node_t *n;
+
+	if (lx->tok == TOK_REDIR)
+		return (parse_simple(lx));
+	if (lx->tok == TOK_LPAREN)
+		return (parse_compound(lx));
+	if (lx->tok != TOK_WORD || parse_closer(lx))
+		return (parse_fail(lx));
+	n = parse_compound(lx);
+	if (n || lx->status)
+		return (n);
+	if (!lex_is(lx, "function"))
+		return (parse_simple(lx));
+	if (lex_next(lx) != TOK_WORD)
+		return (parse_fail(lx));
+	name = lx->word;
+	lx->word = NULL;
+	if (lex_next(lx) == TOK_LPAREN && lex_next(lx) != TOK_RPAREN)
+	{
+		free(name);
+		return (parse_fail(lx));
+	}
+	if (lx->tok == TOK_RPAREN)
+		lex_next(lx);
+	return (parse_funcdef(lx, name));
+}
@@ -0,0 +1,140 @@
+#include "myshell.h"
+
+/**
+ * parse_simple - Parses a simple command or a name() function definition.
+ * @lx: The lexer, positioned on the first word or redirection.
+ *
+ * Redirections may come anywhere among the words.
+ *
+ * Return: The command node, or NULL on error.
+ */
+node_t *parse_simple(lexer_t *lx)
+{
+	wordlist_t wl = {NULL, 0, 0, 0}, rl = {NULL, 0, 0, 0};
+	node_t *n = node_new(NODE_SIMPLE, lx->line);
+	char *name;
+
+	if (!n)
+		return (NULL);
+	while (!lx->status && (lx->tok == TOK_WORD || lx->tok == TOK_REDIR))
+	{
+		if (lx->tok == TOK_REDIR)
+		{
+			parse_redir(lx, &rl);
+			continue;
+		}
+		wl_push(&wl, lx->word);
+		lx->word = NULL;
+		lex_next(lx);
+	}
+	n->words = wl.v ? wl.v : malloc(sizeof(char *));
+	n->redirs = rl.v;
+	if (n->words && !wl.v)
+		n->words[0] = NULL; /* redirections only */
+	if (lx->status || !n->words)
+		return (node_free(n), NULL);
+	if (lx->tok != TOK_LPAREN || wl.n != 1 || rl.n)
+		return (n);
+	name = wl.v[0];
+	wl.v[0] = NULL;
+	node_free(n);
+	if (lex_next(lx) != TOK_RPAREN)
+	{
+		free(name);
+		return (parse_fail(lx));
+	}
+	lex_next(lx);
+	return (parse_funcdef(lx, name));
+}
+
+/**
+ * parse_group - Parses a { list; } group.
+ * @lx: The lexer, positioned on the '{'.
+ *
+ * Return: The group node, or NULL on error.
+ */
+node_t *parse_group(lexer_t *lx)
+{
+	node_t *n = node_new(NODE_GROUP, lx->line);
+
+	if (!n)
+		return (NULL);
+	lex_next(lx);
+	n->left = parse_list(lx);
+	if (!n->left || !lex_is(lx, "}"))
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	lex_next(lx);
+	return (n);
+}
+
+/**
+ * parse_funcdef - Parses the body of a function definition.
+ * @lx: The lexer, positioned after "name()" or "function name".
+ * @name: The function name; ownership passes to the new node.
+ *
+ * The body must be a compound command; it is stored once when the
+ * definition runs and then shared by every call.
+ *
+ * Return: The definition node, or NULL on error.
+ */
+node_t *parse_funcdef(lexer_t *lx, char *name)
+{
+	node_t *n = node_new(NODE_FUNC, lx->line);
+
+	if (!n)
+	{
+		free(name);
+		return (NULL);
+	}
+	n->name = name;
+	while (lx->tok == TOK_NEWLINE)
+		lex_next(lx);
+	n->left = parse_compound(lx);
+	if (!n->left)
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	return (n);
+}
+
+/**
+ * parse_fail - Records a syntax error at the current token.
+ * @lx: The lexer.
+ *
+ * An error at the end of the input means the construct is merely
+ * incomplete, so lx->status becomes PARSE_MORE rather than PARSE_ERROR.
+ * An error already recorded is kept.
+ *
+ * Return: Always NULL, for the caller to return.
+ */
+node_t *parse_fail(lexer_t *lx)
+{
+	if (!lx->status)
+		lx->status = lx->tok == TOK_EOF ? PARSE_MORE : PARSE_ERROR;
+	return (NULL);
+}
+
+/**
+ * parse_closer - Checks whether the current token ends a list.
+ * @lx: The lexer.
+ *
+ * Return: 1 at the end of the input, at ')' or ';;', or at a reserved
+ *         word closing a compound command; 0 otherwise.
+ */
+int parse_closer(lexer_t *lx)
+{
+	static const char * const words[] = {"}", "then", "elif", "else", "fi",
+		"do", "done", "esac", NULL};
+	int a;
+
+	if (lx->tok == TOK_EOF || lx->tok == TOK_RPAREN || lx->tok == TOK_DSEMI)
+		return (1);
+	for (a = 0; words[a]; a++)
+		if (lex_is(lx, words[a]))
+			return (1);
+	return (0);
+}
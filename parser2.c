@@ -0,0 +1,177 @@
+#include "myshell.h"
+
+/**
+ * parse_if - Parses an if (or elif) command up to its 'fi'.
+ * @lx: The lexer, positioned on 'if' or 'elif'.
+ *
+ * An elif chain becomes nested NODE_IF nodes in 'alt', the innermost
+ * one consuming the shared 'fi'.
+ *
+ * Return: The NODE_IF node, or NULL on error.
+ */
+node_t *parse_if(lexer_t *lx)
+{
+	node_t *n = node_new(NODE_IF, lx->line);
+
+	if (!n)
+		return (NULL);
+	lex_next(lx);
+	n->left = parse_list(lx);
+	if (n->left && lex_is(lx, "then"))
+	{
+		lex_next(lx);
+		n->right = parse_list(lx);
+	}
+	if (n->right && lex_is(lx, "elif"))
+		n->alt = parse_if(lx);
+	else if (n->right && lex_is(lx, "else"))
+	{
+		lex_next(lx);
+		n->alt = parse_list(lx);
+		if (n->alt && !lex_is(lx, "fi"))
+			parse_fail(lx);
+		lex_next(lx);
+	}
+	else if (n->right && lex_is(lx, "fi"))
+		return (lex_next(lx), n);
+	if (!n->alt || lx->status)
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	return (n);
+}
+
+/**
+ * parse_loop - Parses a while or until loop.
+ * @lx: The lexer, positioned on 'while' or 'until'.
+ *
+ * Return: The NODE_WHILE or NODE_UNTIL node, or NULL on error.
+ */
+node_t *parse_loop(lexer_t *lx)
+{
+	node_t *n = node_new(lex_is(lx, "while") ? NODE_WHILE : NODE_UNTIL,
+			lx->line);
+
+	if (!n)
+		return (NULL);
+	lex_next(lx);
+	n->left = parse_list(lx);
+	if (!n->left)
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	return (parse_do(lx, n));
+}
+
+/**
+ * parse_do - Parses the do ... done body of a loop.
+ * @lx: The lexer, positioned on 'do'.
+ * @n: The loop node; the body is stored in its 'right'.
+ *
+ * Return: @n, or NULL on error (@n is then freed).
+ */
+node_t *parse_do(lexer_t *lx, node_t *n)
+{
+	if (lex_is(lx, "do"))
+	{
+		lex_next(lx);
+		n->right = parse_list(lx);
+	}
+	if (!n->right || !lex_is(lx, "done"))
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	lex_next(lx);
+	return (n);
+}
+
+/**
+ * parse_for - Parses a for NAME [in WORD...] loop.
+ * @lx: The lexer, positioned on 'for'.
+ *
+ * Without 'in' the loop runs over "$@", marked by NULL 'words'.
+ *
+ * Return: The NODE_FOR node, or NULL on error.
+ */
+node_t *parse_for(lexer_t *lx)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	node_t *n = node_new(NODE_FOR, lx->line);
+
+	if (!n)
+		return (NULL);
+	if (lex_next(lx) != TOK_WORD || var_name_len(lx->word) != strlen(lx->word))
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	n->name = lx->word;
+	lx->word = NULL;
+	lex_next(lx);
+	while (lx->tok == TOK_NEWLINE)
+		lex_next(lx);
+	if (lex_is(lx, "in"))
+	{
+		while (lex_next(lx) == TOK_WORD)
+		{
+			wl_push(&wl, lx->word);
+			lx->word = NULL;
+		}
+		n->words = wl.v ? wl.v : malloc(sizeof(char *));
+		if (n->words && !wl.v)
+			n->words[0] = NULL;
+	}
+	if (lx->tok == TOK_SEMI)
+		lex_next(lx);
+	while (lx->tok == TOK_NEWLINE)
+		lex_next(lx);
+	return (parse_do(lx, n));
+}
+
+/**
+ * parse_case - Parses a case WORD in ... esac command.
+ * @lx: The lexer, positioned on 'case'.
+ *
+ * Return: The NODE_CASE node, its arms chained from 'right', or NULL on
+ *         error.
+ */
+node_t *parse_case(lexer_t *lx)
+{
+	node_t *n = node_new(NODE_CASE, lx->line), **tail;
+
+	if (!n)
+		return (NULL);
+	n->words = malloc(sizeof(char *) * 2);
+	if (!n->words || lex_next(lx) != TOK_WORD)
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	n->words[0] = lx->word;
+	n->words[1] = NULL;
+	lx->word = NULL;
+	do {
+		lex_next(lx);
+	} while (lx->tok == TOK_NEWLINE);
+	if (!lex_is(lx, "in"))
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	lex_next(lx);
+	for (tail = &n->right; !lx->status; tail = &(*tail)->next)
+	{
+		while (lx->tok == TOK_NEWLINE)
+			lex_next(lx);
+		if (lex_is(lx, "esac"))
+			return (lex_next(lx), n);
+		*tail = parse_arm(lx);
+		if (!*tail)
+			break;
+	}
+	node_free(n);
+	return (parse_fail(lx));
+}
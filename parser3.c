@@ -0,0 +1,171 @@
+#include "myshell.h"
+
+/**
+ * parse_compound - Parses a compound command if one starts here.
+ * @lx: The lexer.
+ *
+ * Redirections following the command apply to all of it.
+ *
+ * Return: The node of a { } group, ( ) subshell, [[ ]] conditional, if,
+ *         while, until, for or case command; NULL on error or if the current token does not
+ *         start a compound command (lx->status tells the two apart).
+ */
+node_t *parse_compound(lexer_t *lx)
+{
+	node_t *n = NULL;
+
+	if (lx->tok == TOK_LPAREN)
+		n = parse_subshell(lx);
+	else if (lex_is(lx, "{"))
+		n = parse_group(lx);
+	else if (lex_is(lx, "[["))
+		n = parse_cond(lx);
+	else if (lex_is(lx, "if"))
+		n = parse_if(lx);
+	else if (lex_is(lx, "while") || lex_is(lx, "until"))
+		n = parse_loop(lx);
+	else if (lex_is(lx, "for"))
+		n = parse_for(lx);
+	else if (lex_is(lx, "case"))
+		n = parse_case(lx);
+	return (n ? parse_redirs(lx, n) : NULL);
+}
+
+/**
+ * parse_arm - Parses one PATTERN[|PATTERN...]) list ;; arm of a case.
+ * @lx: The lexer, positioned on the first pattern or an optional '('.
+ *
+ * The list may be empty, and the ';;' may be left out before 'esac'.
+ *
+ * Return: The NODE_ARM node, or NULL on error.
+ */
+node_t *parse_arm(lexer_t *lx)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	node_t *n = node_new(NODE_ARM, lx->line);
+
+	if (!n)
+		return (NULL);
+	if (lx->tok == TOK_LPAREN)
+		lex_next(lx);
+	while (lx->tok == TOK_WORD)
+	{
+		wl_push(&wl, lx->word);
+		lx->word = NULL;
+		if (lex_next(lx) != TOK_PIPE)
+			break;
+		lex_next(lx);
+	}
+	n->words = wl.v;
+	if (!n->words || lx->tok != TOK_RPAREN)
+		parse_fail(lx);
+	else
+	{
+		lex_next(lx);
+		n->left = parse_list(lx);
+	}
+	if (!lx->status && lx->tok == TOK_DSEMI)
+		lex_next(lx);
+	else if (!lx->status && !lex_is(lx, "esac"))
+		parse_fail(lx);
+	if (lx->status)
+	{
+		node_free(n);
+		return (NULL);
+	}
+	return (n);
+}
+
+/**
+ * parse_redir - Parses a redirection of a simple command.
+ * @lx: The lexer, positioned on the operator.
+ * @rl: Receives the redirection.
+ *
+ * A redirection is kept as one string: the file descriptor, a letter for
+ * its kind and its operand as written. The kinds are 'r' (<), 'w' (> and
+ * >|), 'a' (>>), 'b' (<>) and 'd' (<& and >&, whose operand is a
+ * descriptor number or '-' to close); "H" and "h" are here-documents
+ * followed by their body, which is expanded when the command runs unless
+ * the delimiter was quoted ("h"); "S" is a <<< here-string. A {NAME}
+ * written before the operator stays in place of the number (see
+ * redir_named()).
+ *
+ * Return: 0 on success, -1 on error (see lx->status).
+ */
+int parse_redir(lexer_t *lx, wordlist_t *rl)
+{
+	static const char *ops[] = {"<", ">", ">|", ">>", "<>", "<&", ">&", "<<<",
+		NULL};
+	static const char kinds[] = "rwwabddS";
+	const char *op = lx->text;
+	int a, fd = lx->fd >= 0 ? lx->fd : *op == '>';
+	char *r, *name = lx->fd == -2 ? lx->fdname : NULL;
+
+	if (lex_next(lx) != TOK_WORD)
+		return (parse_fail(lx), -1);
+	for (a = 0; ops[a] && strcmp(ops[a], op); a++)
+		;
+	if (!ops[a] && name)
+		return (parse_fail(lx), -1);
+	if (ops[a])
+	{
+		r = malloc(strlen(lx->word) + 16 + (name ? strcspn(name, "}") : 0));
+		if (r && name)
+			sprintf(r, "{%.*s}%c%s", (int)strcspn(name, "}"), name, kinds[a],
+					lx->word);
+		else if (r)
+			sprintf(r, "%d%c%s", fd, kinds[a], lx->word);
+	}
+	else
+		r = lex_heredoc(lx, lx->word, op[2] == '-', fd);
+	if (lx->status)
+		return (free(r), -1);
+	wl_push(rl, r);
+	lex_next(lx);
+	return (0);
+}
+
+/**
+ * parse_subshell - Parses a ( list ) subshell.
+ * @lx: The lexer, positioned on the '('.
+ *
+ * Return: The subshell node, or NULL on error.
+ */
+node_t *parse_subshell(lexer_t *lx)
+{
+	node_t *n = node_new(NODE_SUBSHELL, lx->line);
+
+	if (!n)
+		return (NULL);
+	lex_next(lx);
+	n->left = parse_list(lx);
+	if (!n->left || lx->tok != TOK_RPAREN)
+	{
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	lex_next(lx);
+	return (n);
+}
+
+/**
+ * parse_redirs - Parses the redirections following a compound command.
+ * @lx: The lexer, positioned after the command.
+ * @n: The command; it is freed on error.
+ *
+ * Return: @n, or NULL on error.
+ */
+node_t *parse_redirs(lexer_t *lx, node_t *n)
+{
+	wordlist_t rl = {NULL, 0, 0, 0};
+
+	while (!lx->status && lx->tok == TOK_REDIR)
+		parse_redir(lx, &rl);
+	n->redirs = rl.v;
+	if (lx->status)
+	{
+		node_free(n);
+		return (NULL);
+	}
+	return (n);
+}
@@ -0,0 +1,126 @@
+#include "myshell.h"
+
+/**
+ * parse_stages - Parses the rest of a pipeline.
+ * @lx: The lexer, positioned on the first '|'.
+ * @first: The first command; ownership passes to this function.
+ *
+ * Return: The NODE_PIPE node, whose stages are linked through 'next'
+ *         from its 'left', or NULL on error (see lx->status).
+ */
+node_t *parse_stages(lexer_t *lx, node_t *first)
+{
+	node_t *n = node_new(NODE_PIPE, first->line), *tail = first;
+
+	if (!n)
+	{
+		node_free(first);
+		return (NULL);
+	}
+	n->left = first;
+	while (!lx->status && lx->tok == TOK_PIPE)
+	{
+		do {
+			lex_next(lx);
+		} while (lx->tok == TOK_NEWLINE);
+		tail->next = parse_command(lx);
+		if (!tail->next)
+			break;
+		tail = tail->next;
+	}
+	if (lx->status)
+	{
+		node_free(n);
+		return (NULL);
+	}
+	return (n);
+}
+
+/**
+ * parse_cond - Parses a [[ expression ]] conditional command.
+ * @lx: The lexer, positioned on the '[['.
+ *
+ * The words up to ']]' are kept as written, with the operators &&, ||,
+ * (, ), < and > among them, and are only expanded as the expression is
+ * evaluated (see cond_run()). The operand of =~ is read by parse_regex().
+ *
+ * Return: The NODE_COND node, or NULL on error.
+ */
+node_t *parse_cond(lexer_t *lx)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	node_t *n = node_new(NODE_COND, lx->line);
+	char *w;
+
+	if (!n)
+		return (NULL);
+	lex_next(lx);
+	while (!lx->status && !lex_is(lx, "]]"))
+	{
+		if (lx->tok == TOK_WORD)
+			w = lx->word, lx->word = NULL;
+		else if (lx->tok == TOK_AND_IF || lx->tok == TOK_OR_IF ||
+				lx->tok == TOK_LPAREN || lx->tok == TOK_RPAREN ||
+				(lx->tok == TOK_REDIR && lx->fd == -1 &&
+				 (!strcmp(lx->text, "<") || !strcmp(lx->text, ">"))))
+			w = dupStrn(lx->text);
+		else
+			break;
+		if (wl_push(&wl, w))
+			break;
+		if (!strcmp(w, "=~") && parse_regex(lx, &wl))
+			break;
+		lex_next(lx);
+		while (lx->tok == TOK_NEWLINE && (!strcmp(w, "&&") || !strcmp(w, "||")))
+			lex_next(lx);
+	}
+	if (lx->status || !lex_is(lx, "]]") || !wl.n)
+	{
+		free_strn(wl.v);
+		node_free(n);
+		return (parse_fail(lx));
+	}
+	n->words = wl.v;
+	lex_next(lx);
+	return (n);
+}
+
+/**
+ * parse_regex - Reads the operand of =~ in a [[ ]] command.
+ * @lx: The lexer, right after the '=~'.
+ * @wl: Receives the operand as written.
+ *
+ * The operand runs to the first blank outside quotes and parentheses,
+ * so a regular expression may hold (, ), |, < and > without quoting.
+ *
+ * Return: 0 on success, -1 on error (see lx->status).
+ */
+int parse_regex(lexer_t *lx, wordlist_t *wl)
+{
+	char *s = lx->src + lx->pos, *q;
+	strbuf_t sb = {NULL, 0, 0};
+	size_t a = 0, start;
+	int depth = 0;
+
+	while (s[a] == ' ' || s[a] == '\t')
+		a++;
+	for (start = a; s[a] && (depth || !str_chr(" \t\n;&", s[a])); a++)
+	{
+		if (s[a] == '\\' && s[a + 1])
+			a++;
+		else if ((s[a] == '\'' || s[a] == '"') && (q = str_chr(s + a + 1, s[a])))
+			a = q - s;
+		else if (s[a] == '(' || (s[a] == ')' && depth))
+			depth += s[a] == '(' ? 1 : -1;
+		else if (s[a] == ')')
+			break;
+	}
+	if (a == start || depth)
+	{
+		lx->tok = s[a] ? TOK_WORD : TOK_EOF;
+		return (parse_fail(lx), -1);
+	}
+	lx->pos += a;
+	sb_add(&sb, s + start, a - start);
+	return (wl_push(wl, sb_take(&sb)));
+}
@@ -0,0 +1,110 @@
+#include "myshell.h"
+
+/**
+ * expand_pattern - Expands a raw word into a pattern.
+ * @info: The parameter struct holding the shell variables.
+ * @word: The word as written, quotes included.
+ * @regex: Non-zero for an extended regular expression rather than a
+ *         shell pattern.
+ *
+ * Like expand_word(), but quoted characters are escaped rather than
+ * having their quotes removed, so "*" or \* only match a literal '*'.
+ * The values of unquoted expansions stay patterns.
+ *
+ * Return: A newly allocated pattern, or NULL on failure.
+ */
+char *expand_pattern(info_t *info, char *word, int regex)
+{
+	strbuf_t sb = {NULL, 0, 0}, val = {NULL, 0, 0};
+	wordlist_t wl = {NULL, 0, 0, 0};
+	size_t n, a;
+	int keep = 0, dq = 0, q = regex ? 2 : 1;
+
+	word += expand_tilde(info, word, &sb, &keep);
+	while (*word)
+	{
+		n = *word == '$' ? expand_param(info, word, &val, &wl, &keep, 1) : 0;
+		for (a = 0; a < wl.n; a++) /* "$@" and ${a[@]} join with spaces */
+			pattern_add(&sb, wl.v[a], strlen(wl.v[a]), dq * q), sb_addc(&sb, ' ');
+		free_strn(wl.v), wl.v = NULL, wl.n = wl.cap = 0;
+		if (n)
+			pattern_add(&sb, val.s ? val.s : "", val.len, dq * q), word += n;
+		else if (*word == '"')
+			dq = !dq, word++;
+		else if (*word == '\'' && !dq)
+		{
+			for (n = 1; word[n] && word[n] != '\''; n++)
+				;
+			pattern_add(&sb, word + 1, n - 1, q);
+			word += n + (word[n] == '\'');
+		}
+		else if (*word == '\\' && word[1] && (!dq || str_chr("$\"\\`", word[1])))
+			pattern_add(&sb, word + 1, 1, q), word += 2;
+		else
+			pattern_add(&sb, word++, 1, dq * q);
+		val.len = 0;
+	}
+	free(val.s);
+	return (sb_take(&sb));
+}
+
+/**
+ * pattern_add - Appends text to a pattern.
+ * @sb: The pattern being built.
+ * @s: The text.
+ * @len: The length of @s.
+ * @quoted: 1 to escape the pattern characters of @s, 2 to escape those
+ *          of an extended regular expression, 0 to escape none.
+ */
+void pattern_add(strbuf_t *sb, const char *s, size_t len, int quoted)
+{
+	size_t a;
+
+	for (a = 0; a < len; a++)
+	{
+		if (s[a] && str_chr(quoted == 2 ? "\\.[]()*+?{}|^$" :
+					quoted ? "*?[]\\" : "", s[a]))
+			sb_addc(sb, '\\');
+		sb_addc(sb, s[a]);
+	}
+}
+
+/**
+ * pattern_match - Matches a string against a shell pattern.
+ * @info: The parameter struct holding the compiled patterns.
+ * @pattern: The pattern; \ escapes the next character.
+ * @string: The string.
+ *
+ * Return: 1 if the whole of @string matches, 0 otherwise.
+ */
+int pattern_match(info_t *info, const char *pattern, const char *string)
+{
+	pattern_t *p = pattern_get(info, pattern, 0);
+	size_t len = strlen(string);
+
+	return (p && pattern_span(p, string, len, 1) == (long)len);
+}
+
+/**
+ * case_match - Matches a case subject against the patterns of an arm.
+ * @info: The parameter struct holding the shell variables.
+ * @subject: The expanded subject; may be NULL if expanding it failed.
+ * @patterns: The patterns as written.
+ *
+ * Patterns are expanded one at a time, and only until one matches.
+ *
+ * Return: 1 if a pattern matches, 0 otherwise.
+ */
+int case_match(info_t *info, char *subject, char **patterns)
+{
+	char *pattern;
+	int match = 0;
+
+	for (; subject && !match && *patterns; patterns++)
+	{
+		pattern = expand_pattern(info, *patterns, 0);
+		match = pattern && pattern_match(info, pattern, subject);
+		free(pattern);
+	}
+	return (match);
+}
@@ -0,0 +1,207 @@
+#include "myshell.h"
+#include <ctype.h>
+
+/**
+ * pattern_compile - Compiles a shell pattern for pattern_span().
+ * @text: The pattern; \ escapes the next character.
+ * @reverse: Non-zero to compile it for matching from the end of a string
+ *           backwards, as ${var%pat} does.
+ *
+ * Every item gets one bit, and each byte a mask of the items it matches,
+ * so a match runs over the string once, with no backtracking however
+ * many stars the pattern has.
+ *
+ * Return: The compiled pattern, or NULL if allocation fails.
+ */
+pattern_t *pattern_compile(const char *text, int reverse)
+{
+	pattern_t *p = malloc(sizeof(pattern_t));
+	size_t k, b, c, bits = sizeof(long) * CHAR_BIT;
+	unsigned char set[256];
+	const char *t = text;
+	int kind;
+
+	if (!p)
+		return (NULL);
+	memset(p, 0, sizeof(pattern_t));
+	while (pattern_next(&t, set))
+		p->items++;
+	p->words = p->items / bits + 1; /* one more bit: all items matched */
+	p->mask = malloc(sizeof(long) * p->words * 257);
+	p->text = dupStrn(text);
+	p->reverse = reverse;
+	if (!p->mask || !p->text)
+	{
+		pattern_free(p);
+		return (NULL);
+	}
+	memset(p->mask, 0, sizeof(long) * p->words * 257);
+	for (t = text, k = 0; (kind = pattern_next(&t, set)); k++)
+	{
+		b = reverse ? p->items - 1 - k : k;
+		for (c = 0; c < 257; c++)
+			if (c == 256 ? kind == 2 : kind == 1 && set[c])
+				p->mask[c * p->words + b / bits] |= 1UL << b % bits;
+	}
+	return (p);
+}
+
+/**
+ * pattern_next - Parses the next item of a pattern.
+ * @pp: Address of the position in the pattern; moved past the item.
+ * @set: Receives the bytes a character item matches.
+ *
+ * A run of stars is a single item.
+ *
+ * Return: 0 at the end of the pattern, 1 for a character, ? or [...],
+ *         2 for a star.
+ */
+int pattern_next(const char **pp, unsigned char *set)
+{
+	const char *p = *pp;
+	size_t n;
+
+	if (!*p)
+		return (0);
+	if (*p == '*')
+	{
+		while (*p == '*')
+			p++;
+		*pp = p;
+		return (2);
+	}
+	memset(set, 0, 256);
+	if (*p == '?')
+		memset(set + 1, 1, 255), n = 1;
+	else if (*p == '[' && (n = pattern_class(p, set)))
+		;
+	else
+	{
+		n = (*p == '\\' && p[1]) ? 2 : 1;
+		set[(unsigned char)p[n - 1]] = 1;
+	}
+	*pp = p + n;
+	return (1);
+}
+
+/**
+ * pattern_class - Parses a [...] bracket expression.
+ * @p: The pattern at the '['.
+ * @set: Receives the bytes the expression matches.
+ *
+ * Supports ranges, negation with ! or ^, a leading ']' as a member and
+ * the [:name:] classes.
+ *
+ * Return: The length of the expression, or 0 if it has no closing ']'
+ *         (the '[' is then an ordinary character).
+ */
+size_t pattern_class(const char *p, unsigned char *set)
+{
+	int neg = p[1] == '!' || p[1] == '^', lo, hi;
+	size_t a = 1 + neg, start = a, n;
+
+	while (p[a] && (p[a] != ']' || a == start))
+	{
+		if (p[a] == '[' && p[a + 1] == ':' && (n = pattern_posix(p + a, set)))
+		{
+			a += n;
+			continue;
+		}
+		a += p[a] == '\\' && p[a + 1];
+		lo = hi = (unsigned char)p[a++];
+		if (p[a] == '-' && p[a + 1] && p[a + 1] != ']')
+		{
+			a += 1 + (p[a + 1] == '\\' && p[a + 2]);
+			hi = (unsigned char)p[a++];
+		}
+		for (; lo <= hi; lo++)
+			set[lo] = 1;
+	}
+	if (!p[a])
+		return (memset(set, 0, 256), 0);
+	for (lo = 1; neg && lo < 256; lo++)
+		set[lo] = !set[lo];
+	set[0] = 0;
+	return (a + 1);
+}
+
+/**
+ * pattern_posix - Parses a [:name:] class inside a bracket expression.
+ * @p: The pattern at the "[:".
+ * @set: Receives the bytes of the class.
+ *
+ * Return: The length of the class, or 0 if it is not a known one.
+ */
+size_t pattern_posix(const char *p, unsigned char *set)
+{
+	static const char *names[] = {"alnum", "alpha", "blank", "cntrl",
+		"digit", "graph", "lower", "print", "punct", "space", "upper",
+		"xdigit", NULL};
+	static int (*const tests[])(int) = {isalnum, isalpha, isblank, iscntrl,
+		isdigit, isgraph, islower, isprint, ispunct, isspace, isupper,
+		isxdigit};
+	const char *end = strstr(p + 2, ":]");
+	int a, c;
+
+	for (a = 0; end && names[a]; a++)
+		if (strlen(names[a]) == (size_t)(end - p - 2) &&
+				!strncmp(p + 2, names[a], end - p - 2))
+		{
+			for (c = 1; c < 256; c++)
+				set[c] |= tests[a](c) ? 1 : 0;
+			return (end - p + 2);
+		}
+	return (0);
+}
+
+/**
+ * pattern_span - Matches a compiled pattern against the start of a string.
+ * @p: The pattern; one compiled in reverse matches the end of @s.
+ * @s: The string.
+ * @len: The length of @s.
+ * @longest: Non-zero for the longest match, zero for the shortest.
+ *
+ * Bit k of the state is set while the items before item k have matched;
+ * a byte moves each bit on through the items matching it, and stars keep
+ * theirs.
+ *
+ * Return: The length of the matching part of @s, or -1 if none matches.
+ */
+long pattern_span(pattern_t *p, const char *s, size_t len, int longest)
+{
+	unsigned long buf[8], *d = p->words > 4 ?
+		malloc(sizeof(long) * p->words * 2) : buf, *t, *m, *star, carry, any;
+	size_t bits = sizeof(long) * CHAR_BIT, i, w, last = p->items;
+	long span = -1;
+
+	if (!d)
+		return (-1);
+	t = d + p->words, star = p->mask + 256 * p->words;
+	memset(d, 0, sizeof(long) * p->words);
+	d[0] = 1 | (star[0] & 1) << 1;
+	for (i = 0, any = 1; any && (span < 0 || longest); i++)
+	{
+		if (d[last / bits] >> last % bits & 1)
+			span = i;
+		if (i == len)
+			break;
+		m = p->mask + p->words *
+			(unsigned char)s[p->reverse ? len - 1 - i : i];
+		for (w = 0, carry = 0, any = 0; w < p->words; w++)
+		{
+			t[w] = d[w] & m[w];
+			d[w] = (t[w] << 1 | carry) | (d[w] & star[w]);
+			carry = t[w] >> (bits - 1);
+		}
+		for (w = 0, carry = 0; w < p->words; w++) /* step past new stars */
+		{
+			t[w] = d[w] & star[w];
+			d[w] |= t[w] << 1 | carry;
+			carry = t[w] >> (bits - 1);
+			any |= d[w];
+		}
+	}
+	if (d != buf)
+		free(d);
+	return (span);
+}
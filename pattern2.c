@@ -0,0 +1,77 @@
+#include "myshell.h"
+
+/**
+ * pattern_get - Compiles a pattern, or reuses the one compiled before.
+ * @info: The parameter struct holding the compiled patterns.
+ * @text: The pattern.
+ * @reverse: Non-zero for one matching from the end of a string.
+ *
+ * Patterns are kept by their text, so a case arm or a glob run in a loop
+ * is compiled once. Once PATTERN_MAX are kept they are all dropped.
+ *
+ * Return: The compiled pattern (owned by the table), or NULL if
+ *         allocation fails.
+ */
+pattern_t *pattern_get(info_t *info, const char *text, int reverse)
+{
+	unsigned int hash = var_hash(text, strlen(text)) ^ reverse;
+	pattern_t *p, **bucket;
+
+	if (!info->patterns)
+	{
+		info->patterns = malloc(sizeof(pattern_t *) * PATTERN_BUCKETS);
+		if (!info->patterns)
+			return (NULL);
+		memset(info->patterns, 0, sizeof(pattern_t *) * PATTERN_BUCKETS);
+	}
+	bucket = &info->patterns[hash & (PATTERN_BUCKETS - 1)];
+	for (p = *bucket; p; p = p->next)
+		if (p->hash == hash && p->reverse == reverse && !strcmp(p->text, text))
+			return (p);
+	if (info->npatterns >= PATTERN_MAX)
+	{
+		patterns_free(info);
+		return (pattern_get(info, text, reverse));
+	}
+	p = pattern_compile(text, reverse);
+	if (!p)
+		return (NULL);
+	p->hash = hash;
+	p->next = *bucket;
+	*bucket = p;
+	info->npatterns++;
+	return (p);
+}
+
+/**
+ * pattern_free - Frees a compiled pattern.
+ * @p: The pattern; may be NULL.
+ */
+void pattern_free(pattern_t *p)
+{
+	if (!p)
+		return;
+	free(p->text);
+	free(p->mask);
+	free(p);
+}
+
+/**
+ * patterns_free - Frees every compiled pattern.
+ * @info: The parameter struct holding them.
+ */
+void patterns_free(info_t *info)
+{
+	pattern_t *p, *next;
+	int a;
+
+	for (a = 0; info->patterns && a < PATTERN_BUCKETS; a++)
+		for (p = info->patterns[a]; p; p = next)
+		{
+			next = p->next;
+			pattern_free(p);
+		}
+	free(info->patterns);
+	info->patterns = NULL;
+	info->npatterns = 0;
+}
@@ -0,0 +1,189 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+
+/**
+ * vm_pipe - Runs a pipeline.
+ * @info: The parameter struct.
+ * @cmds: The stages, one command each.
+ * @n: The number of stages, at least 2.
+ *
+ * Stages that pipe_inproc() allows run in the shell itself rather than
+ * in a child, as one consecutive run chosen by pipe_choose(). Every other
+ * stage is forked first, so the pipes around the run have their other
+ * ends served while it runs and none of them can fill up for good.
+ * The status is the status of the last stage.
+ */
+void vm_pipe(info_t *info, cmd_t *cmds, int n)
+{
+	int *fds = malloc(sizeof(int) * 2 * n), first, last, k, a;
+	pid_t *pids = malloc(sizeof(pid_t) * n);
+
+	if (!fds || !pids)
+	{
+		free(fds), free(pids);
+		info->status = 1;
+		return;
+	}
+	info->line_count = cmds[0].line;
+	pipe_choose(info, cmds, n, &first, &last);
+	for (k = 0; k < n - 1; k++) /* stage k writes fds[2k + 1], k + 1 reads fds[2k] */
+	{
+		fds[2 * k] = fds[2 * k + 1] = -1;
+		if ((k < first || k >= last) && pipe2(fds + 2 * k, O_CLOEXEC))
+			perror("Error:");
+	}
+	fds[2 * k] = fds[2 * k + 1] = -1;
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	for (k = 0; k < n; k++)
+		pids[k] = k >= first && k <= last ? 0 :
+			pipe_spawn(info, &cmds[k], fds, n, k);
+	for (a = 0; a < 2 * (n - 1); a++)
+		if (fds[a] != -1 && a != 2 * first - 2 && a != 2 * last + 1)
+			close(fds[a]), fds[a] = -1;
+	if (first >= 0)
+		pipe_local(info, cmds, first, last, fds);
+	pipe_wait(info, pids, n);
+	free(fds);
+	free(pids);
+}
+
+/**
+ * pipe_choose - Chooses the stages of a pipeline run by the shell.
+ * @info: The parameter struct.
+ * @cmds: The stages.
+ * @n: The number of stages.
+ * @first: Receives the first stage of the run, -1 if there is none.
+ * @last: Receives the last stage of the run, -1 if there is none.
+ *
+ * The longest run of consecutive stages pipe_inproc() allows is taken,
+ * and of equally long runs the last one, which writes straight to the
+ * shell's output.
+ */
+void pipe_choose(info_t *info, cmd_t *cmds, int n, int *first, int *last)
+{
+	int k, start = -1;
+
+	*first = *last = -1;
+	for (k = 0; k <= n; k++)
+	{
+		if (k < n && pipe_inproc(info, &cmds[k]))
+		{
+			if (start < 0)
+				start = k;
+			continue;
+		}
+		if (start >= 0 && (*first < 0 || k - start >= *last - *first + 1))
+			*first = start, *last = k - 1;
+		start = -1;
+	}
+}
+
+/**
+ * pipe_spawn - Forks one stage of a pipeline.
+ * @info: The parameter struct.
+ * @cmd: The stage.
+ * @fds: The pipes of the pipeline (see vm_pipe()); the child closes them
+ *       all once its own ends are in place.
+ * @n: The number of stages.
+ * @k: The index of the stage.
+ *
+ * An external command replaces the child instead of forking again.
+ *
+ * Return: The child's process ID, or -1 if fork() fails.
+ */
+pid_t pipe_spawn(info_t *info, cmd_t *cmd, int *fds, int n, int k)
+{
+	pid_t pid = fork();
+	int a;
+
+	if (pid == -1)
+		perror("Error:");
+	if (pid)
+		return (pid);
+	if (k && fds[2 * k - 2] != -1)
+		dup2(fds[2 * k - 2], STDIN_FILENO);
+	if (k < n - 1 && fds[2 * k + 1] != -1)
+		dup2(fds[2 * k + 1], STDOUT_FILENO);
+	for (a = 0; a < 2 * (n - 1); a++)
+		if (fds[a] != -1)
+			close(fds[a]);
+	if (cmd->sub)
+		vm_run(info, cmd->sub);
+	else
+	{
+		info->nofork = 1;
+		vm_simple(info, cmd);
+	}
+	subshell_exit(info);
+	return (0);
+}
+
+/**
+ * pipe_local - Runs the stages of a pipeline chosen to run in the shell.
+ * @info: The parameter struct.
+ * @cmds: The stages.
+ * @first: The first stage of the run.
+ * @last: The last stage of the run.
+ * @fds: The pipes of the pipeline; the run's input and output ends are
+ *       closed once it is done.
+ *
+ * The stages run one after the other, each one's output kept in a
+ * memfd_create() file for the next, with the shell's standard input and
+ * output pointed at them meanwhile. SIGPIPE is ignored while they run,
+ * so a reader that quits early makes a write fail instead of killing the
+ * shell.
+ */
+void pipe_local(info_t *info, cmd_t *cmds, int first, int last, int *fds)
+{
+	int k, in = first ? fds[2 * first - 2] : -1, out, saved[2];
+	void (*old)(int) = signal(SIGPIPE, SIG_IGN);
+
+	saved[0] = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, REDIR_FDS);
+	saved[1] = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, REDIR_FDS);
+	for (k = first; k <= last; k++, in = out)
+	{
+		out = k < last ? memfd_create("hsh-pipe", MFD_CLOEXEC) : fds[2 * k + 1];
+		if (k < last && out == -1)
+			perror("Error:");
+		if (in != -1)
+			dup2(in, STDIN_FILENO);
+		dup2(out != -1 ? out : saved[1], STDOUT_FILENO);
+		vm_simple(info, &cmds[k]);
+		wrt_chr(BUFFER_FLUSH);
+		fflush(stdout);
+		if (in != -1)
+			close(in);
+		if (k < last && out != -1)
+			lseek(out, 0, SEEK_SET);
+	}
+	if (out != -1)
+		close(out);
+	for (k = 0; k < 2; k++)
+		if (saved[k] == -1)
+			close(k);
+		else
+			dup2(saved[k], k), close(saved[k]);
+	signal(SIGPIPE, old);
+}
+
+/**
+ * pipe_inproc - Checks whether a pipeline stage can run in the shell.
+ * @info: The parameter struct.
+ * @cmd: The stage.
+ *
+ * Only builtins that read their input and write their output without
+ * changing the shell qualify, since a stage run in a child could never
+ * change it either.
+ *
+ * Return: 1 if the stage can run in the shell, 0 otherwise.
+ */
+int pipe_inproc(info_t *info, cmd_t *cmd)
+{
+	int (*b)(info_t *) = cmd->builtin;
+
+	if (cmd->sub || !b || func_find(info, cmd->name))
+		return (0);
+	return (b == hist_cmd || b == env_cmd || b == cat_cmd || b == grep_cmd ||
+			b == wc_cmd || b == head_cmd || b == tail_cmd || b == cut_cmd);
+}
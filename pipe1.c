@@ -0,0 +1,27 @@
+#include "myshell.h"
+
+/**
+ * pipe_wait - Waits for the forked stages of a pipeline.
+ * @info: The parameter struct; its status becomes the last stage's when
+ *        that stage was forked.
+ * @pids: The process ID of every stage, 0 for a stage run in the shell
+ *        and -1 for one that could not be forked.
+ * @n: The number of stages.
+ */
+void pipe_wait(info_t *info, pid_t *pids, int n)
+{
+	int k, status;
+
+	for (k = 0; k < n; k++)
+	{
+		if (!pids[k])
+			continue;
+		if (pids[k] == -1 || waitpid(pids[k], &status, 0) == -1)
+			status = 1;
+		else
+			status = WIFEXITED(status) ? WEXITSTATUS(status) :
+				128 + WTERMSIG(status);
+		if (k == n - 1)
+			info->status = status;
+	}
+}
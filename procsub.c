@@ -0,0 +1,126 @@
+#include "myshell.h"
+
+/**
+ * procsub_expand - Expands a <(...) or >(...) process substitution.
+ * @info: The parameter struct.
+ * @word: The word at the '<' or '>'.
+ * @sb: Receives the /dev/fd/N name of the pipe.
+ *
+ * Return: The length of the substitution in @word, or 0 if its
+ *         parenthesis is not closed and it is ordinary text.
+ */
+size_t procsub_expand(info_t *info, char *word, strbuf_t *sb)
+{
+	size_t a, n, len = strlen(word);
+	char *text, name[32];
+	int depth = 1, fd;
+
+	for (a = 2; a < len && depth; a += n ? n : 1)
+	{
+		n = brace_skip(word + a, len - a);
+		if (!n)
+			depth += (word[a] == '(') - (word[a] == ')');
+	}
+	if (depth)
+		return (0);
+	text = malloc(a - 2);
+	if (!text)
+		return (a);
+	memcpy(text, word + 2, a - 3);
+	text[a - 3] = '\0';
+	fd = procsub_open(info, text, *word == '>');
+	free(text);
+	if (fd != -1)
+		sb_add(sb, name, sprintf(name, "/dev/fd/%d", fd));
+	return (a);
+}
+
+/**
+ * procsub_open - Starts the command of a process substitution.
+ * @info: The parameter struct; the substitution joins its list.
+ * @text: The command.
+ * @out: Non-zero for >(...), whose command reads what is written to the
+ *       pipe, zero for <(...), whose command writes into it.
+ *
+ * The shell's end of the pipe is moved above the redirected descriptors
+ * and left without close-on-exec, so the command being expanded inherits
+ * it. procsub_reap() closes it once that command is done.
+ *
+ * Return: The shell's end of the pipe, or -1 on failure.
+ */
+int procsub_open(info_t *info, char *text, int out)
+{
+	procsub_t *ps = malloc(sizeof(procsub_t));
+	int fds[2], c = !out, fd;
+
+	if (!ps || pipe(fds))
+		return (free(ps), -1);
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	ps->pid = fork();
+	if (!ps->pid)
+	{
+		dup2(fds[c], c);
+		close(fds[0]);
+		close(fds[1]);
+		procsub_run(info, text);
+	}
+	close(fds[c]);
+	fd = fcntl(fds[!c], F_DUPFD, REDIR_FDS);
+	if (fd == -1)
+		fd = fds[!c];
+	else
+		close(fds[!c]);
+	if (ps->pid == -1)
+		return (close(fd), free(ps), -1);
+	ps->fd = fd;
+	ps->next = info->procsubs;
+	info->procsubs = ps;
+	return (fd);
+}
+
+/**
+ * procsub_run - Runs the command of a process substitution and exits.
+ * @info: The parameter struct, in the child process.
+ * @text: The command.
+ */
+void procsub_run(info_t *info, char *text)
+{
+	procsub_t *ps;
+	node_t *tree;
+	prog_t *prog = NULL;
+
+	for (ps = info->procsubs; ps; ps = ps->next)
+		close(ps->fd);
+	info->procsubs = NULL;
+	if (parse_program(info, text, info->line_count, &tree) == PARSE_OK)
+		prog = compile_program(tree);
+	if (prog)
+		vm_run(info, prog);
+	else
+		info->status = 2;
+	subshell_exit(info);
+}
+
+/**
+ * procsub_reap - Closes the pipes of the process substitutions of a
+ *                command and waits for their processes.
+ * @info: The parameter struct holding them.
+ *
+ * Closing first lets a >(...) command see the end of its input, and makes
+ * a <(...) command that was not read to the end stop on SIGPIPE.
+ */
+void procsub_reap(info_t *info)
+{
+	procsub_t *ps, *next;
+
+	for (ps = info->procsubs; ps; ps = ps->next)
+		close(ps->fd);
+	for (ps = info->procsubs; ps; ps = next)
+	{
+		next = ps->next;
+		waitpid(ps->pid, NULL, 0);
+		free(ps);
+	}
+	info->procsubs = NULL;
+}
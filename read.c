@@ -0,0 +1,187 @@
+#include "myshell.h"
+#include <poll.h>
+
+/**
+ * read_cmd - Reads a line into shell variables.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: read [-r] [-d delim] [-n count] [-t timeout] [-u fd] [name...]
+ * The line is split on IFS: each name gets one field and the last one
+ * the rest of the line. Without a name the whole line goes to REPLY.
+ * Unless -r is given, a backslash escapes the next byte and one before
+ * the delimiter joins the next line on. The input is read in large
+ * blocks and scanned with memchr() (see read_input()), never past the
+ * delimiter as far as other readers of the descriptor can tell.
+ *
+ * Return: 0 on success, 1 at the end of the input or on error, 2 on a
+ *         usage error, 128 + SIGALRM when the timeout runs out.
+ */
+int read_cmd(info_t *info)
+{
+	readopts_t o;
+	strbuf_t sb = {NULL, 0, 0};
+	int a = read_opts(info, &o), ret;
+	struct pollfd p;
+
+	if (a < 0)
+		return (2);
+	for (ret = a; info->argv[ret]; ret++)
+		if (!*info->argv[ret] || info->argv[ret][var_name_len(info->argv[ret])])
+		{
+			fprintf(stderr, "%s: %d: read: %s: not a valid identifier\n",
+					info->fname, info->line_count, info->argv[ret]);
+			return (1);
+		}
+	if (!o.timeout)
+	{
+		p.fd = o.fd, p.events = POLLIN;
+		return (poll(&p, 1, 0) == 1 ? 0 : 1);
+	}
+	ret = read_input(info, &o, &sb);
+	if (ret == -1)
+		fprintf(stderr, "%s: %d: read: %d: %s\n", info->fname,
+				info->line_count, o.fd, strerror(errno));
+	if (read_assign(info, &sb, o.raw, info->argv + a) && !ret)
+		ret = -1;
+	free(sb.s);
+	return (!ret ? 0 : ret == 2 ? 128 + SIGALRM : 1);
+}
+
+/**
+ * read_opts - Parses the options of a read command.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @o: Receives the options; a timeout becomes a deadline at once.
+ *
+ * Return: The index of the first name, or -1 after a usage error.
+ */
+int read_opts(info_t *info, readopts_t *o)
+{
+	char **argv = info->argv, *v, *end;
+	double t;
+	int a;
+
+	memset(o, 0, sizeof(*o));
+	o->delim = '\n', o->max = -1, o->timeout = -1;
+	for (a = 1; argv[a] && argv[a][0] == '-' && argv[a][1]; a++)
+	{
+		if (!strcmp(argv[a], "--"))
+			return (a + 1);
+		if (!strcmp(argv[a], "-r"))
+		{
+			o->raw = 1;
+			continue;
+		}
+		v = argv[a + 1], end = "?";
+		if (argv[a][2] || !v)
+			break;
+		if (argv[a][1] == 'd')
+			o->delim = *v, end = "";
+		else if (argv[a][1] == 't' && (t = strtod(v, &end)) >= 0 &&
+				t < LONG_MAX / 1000)
+			o->timeout = t * 1000;
+		else if (argv[a][1] == 'n' && (o->max = strtol(v, &end, 10)) < 0)
+			end = "?";
+		else if (argv[a][1] == 'u' && (o->fd = strtol(v, &end, 10)) < 0)
+			end = "?";
+		if (*end || (!*v && argv[a][1] != 'd'))
+			break;
+		a++;
+	}
+	if (argv[a] && argv[a][0] == '-' && argv[a][1])
+	{
+		printErro(info, "usage: read [-r] [-d delim] [-n count] [-t timeout] "
+				"[-u fd] [name...]");
+		return (-1);
+	}
+	if (o->timeout > 0)
+		o->deadline = read_now() + o->timeout;
+	return (a);
+}
+
+/**
+ * read_assign - Sets the variables of a read command.
+ * @info: The parameter struct holding IFS and the variables.
+ * @sb: The input read, without its delimiter; unless @raw is set its
+ *      escapes are removed here.
+ * @raw: Set when backslashes are not escapes.
+ * @names: The variable names, none for REPLY.
+ *
+ * Leading and trailing IFS whitespace is dropped from each field, and a
+ * separator right at the end of the input does not leave the last name
+ * an empty field. REPLY gets the input as it was.
+ *
+ * Return: 0 on success, 1 if a variable could not be set.
+ */
+int read_assign(info_t *info, strbuf_t *sb, int raw, char **names)
+{
+	char empty[1] = "", *s = sb->s ? sb->s : empty, *esc = NULL;
+	char *ifs = var_value(info, "IFS", 3), c;
+	size_t pos = 0, start, end, len;
+	int a, err = 0;
+
+	if (!raw && sb->len && !(esc = read_unescape(sb)))
+		return (1);
+	len = sb->len;
+	if (!*names)
+		err = !var_set(info, "REPLY", 5, s, 0);
+	for (a = 0; names[a]; a++)
+	{
+		while (pos < len && read_sep(s, esc, pos, ifs) == 1)
+			pos++;
+		start = pos;
+		end = read_field(s, esc, len, &pos, ifs);
+		if (!names[a + 1] && pos < len) /* the last name takes the rest */
+			for (end = pos = len; end > start &&
+					read_sep(s, esc, end - 1, ifs) == 1; end--)
+				;
+		c = s[end], s[end] = '\0';
+		err |= !var_set(info, names[a], lenstrn(names[a]), s + start, 0);
+		s[end] = c;
+	}
+	free(esc);
+	return (err);
+}
+
+/**
+ * read_field - Finds the end of a field of the input read.
+ * @s: The input.
+ * @esc: Marks the bytes of @s that were escaped, NULL if none were.
+ * @len: The length of @s.
+ * @pos: The offset of the field; it is moved past the separator after
+ *       it, that is any IFS whitespace and at most one other IFS byte.
+ * @ifs: The value of IFS, NULL if it is unset.
+ *
+ * Return: The offset of the end of the field.
+ */
+size_t read_field(const char *s, const char *esc, size_t len, size_t *pos,
+		const char *ifs)
+{
+	size_t a = *pos, end;
+
+	while (a < len && !read_sep(s, esc, a, ifs))
+		a++;
+	end = a;
+	while (a < len && read_sep(s, esc, a, ifs) == 1)
+		a++;
+	if (a < len && read_sep(s, esc, a, ifs) == 2)
+		for (a++; a < len && read_sep(s, esc, a, ifs) == 1; a++)
+			;
+	*pos = a;
+	return (end);
+}
+
+/**
+ * read_sep - Classifies a byte of the input read.
+ * @s: The input.
+ * @esc: Marks the bytes of @s that were escaped, NULL if none were.
+ * @a: The offset of the byte.
+ * @ifs: The value of IFS, NULL if it is unset (space, tab and newline).
+ *
+ * Return: 1 for IFS whitespace, 2 for another IFS byte, 0 otherwise.
+ */
+int read_sep(const char *s, const char *esc, size_t a, const char *ifs)
+{
+	if (!s[a] || (esc && esc[a]) || !str_chr(ifs ? (char *)ifs : " \t\n", s[a]))
+		return (0);
+	return (str_chr(" \t\n", s[a]) ? 1 : 2);
+}
@@ -0,0 +1,194 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+#include <poll.h>
+
+/**
+ * read_input - Reads the input of a read command up to its delimiter.
+ * @info: The parameter struct holding the read-ahead buffers.
+ * @o: The options of the command.
+ * @sb: Receives the input, without the delimiter.
+ *
+ * Regular files are read in READ_AHEAD blocks kept between commands,
+ * with the offset put back after the delimiter every time (read_file()),
+ * and pipes are looked into with tee() before taking exactly one line
+ * (read_pipe()); anything else is read a byte at a time. Unless -r was
+ * given, a backslash right before the delimiter joins the next line on.
+ *
+ * Return: 0 on success, 1 at the end of the input, 2 when the timeout
+ *         runs out, -1 on error.
+ */
+int read_input(info_t *info, readopts_t *o, strbuf_t *sb)
+{
+	struct stat st;
+	size_t n;
+	int ret;
+
+	if (fstat(o->fd, &st) == -1)
+		return (-1);
+	for (;;)
+	{
+		if (S_ISREG(st.st_mode))
+			ret = read_file(info, o, sb, &st);
+		else if (S_ISFIFO(st.st_mode))
+			ret = read_pipe(info, o, sb);
+		else
+			ret = read_bytes(o, sb);
+		for (n = 0; !o->raw && !ret && n < sb->len &&
+				sb->s[sb->len - n - 1] == '\\'; n++)
+			;
+		if (n % 2 == 0)
+			break;
+		sb->s[--sb->len] = '\0';
+	}
+	return (ret == 3 ? 0 : ret);
+}
+
+/**
+ * read_file - Reads up to a delimiter from a regular file.
+ * @info: The parameter struct holding the read-ahead buffers.
+ * @o: The options of the command.
+ * @sb: Receives the input.
+ * @st: The file's status, which tells whether the buffer still holds it.
+ *
+ * The input is found in the descriptor's read-ahead buffer with memchr(),
+ * which is refilled with pread() as it runs out, and the file offset is
+ * then set right after the delimiter, so other commands reading the file
+ * start where this one stopped.
+ *
+ * Return: 0 at the delimiter, 1 at the end of the file, 3 once -n count
+ *         bytes are read, -1 on error.
+ */
+int read_file(info_t *info, readopts_t *o, strbuf_t *sb, struct stat *st)
+{
+	readahead_t *ra = readahead_get(info, o->fd, st);
+	size_t n;
+	ssize_t r;
+	char *p, *q;
+	int ret = 3;
+
+	if (!ra)
+		return (read_bytes(o, sb));
+	while (o->max < 0 || sb->len < (size_t)o->max)
+	{
+		if (ra->pos == ra->len)
+		{
+			r = pread(o->fd, ra->buf, READ_AHEAD, ra->off + ra->len);
+			if (r <= 0)
+			{
+				ret = r ? -1 : 1;
+				break;
+			}
+			ra->off += ra->len, ra->len = r, ra->pos = 0;
+		}
+		p = ra->buf + ra->pos, n = ra->len - ra->pos;
+		if (o->max >= 0 && n > o->max - sb->len)
+			n = o->max - sb->len;
+		q = memchr(p, o->delim, n);
+		sb_add(sb, p, q ? (size_t)(q - p) : n);
+		ra->pos += q ? (size_t)(q - p) + 1 : n;
+		if (q)
+		{
+			ret = 0;
+			break;
+		}
+	}
+	lseek(o->fd, ra->off + ra->pos, SEEK_SET);
+	return (ret);
+}
+
+/**
+ * read_pipe - Reads up to a delimiter from a pipe.
+ * @info: The parameter struct holding the peek pipe.
+ * @o: The options of the command.
+ * @sb: Receives the input.
+ *
+ * What the pipe holds is copied into the peek pipe with tee(), which
+ * leaves it in place, and searched with memchr(); then only the bytes up
+ * to the delimiter are read from the pipe itself. A line costs three
+ * system calls instead of one per byte, and the rest stays in the pipe
+ * for whatever reads it next.
+ *
+ * Return: As for read_file(), or 2 when the timeout runs out.
+ */
+int read_pipe(info_t *info, readopts_t *o, strbuf_t *sb)
+{
+	char buf[READ_PEEK], *q;
+	ssize_t n, k;
+	int ret;
+
+	if (read_peek(info))
+		return (read_bytes(o, sb));
+	while (o->max < 0 || sb->len < (size_t)o->max)
+	{
+		ret = read_wait(o);
+		if (ret)
+			return (ret);
+		n = o->max >= 0 && o->max - sb->len < READ_PEEK ?
+			(ssize_t)(o->max - sb->len) : READ_PEEK;
+		n = tee(o->fd, info->peek[1], n, 0);
+		if (n == -1 && errno == EINVAL)
+			return (read_bytes(o, sb));
+		if (n <= 0 || read(info->peek[0], buf, n) != n)
+			return (n ? -1 : 1);
+		q = memchr(buf, o->delim, n);
+		k = q ? q - buf + 1 : n;
+		if (read(o->fd, buf, k) != k)
+			return (-1);
+		sb_add(sb, buf, k - (q != NULL));
+		if (q)
+			return (0);
+	}
+	return (3);
+}
+
+/**
+ * read_bytes - Reads up to a delimiter one byte at a time.
+ * @o: The options of the command.
+ * @sb: Receives the input.
+ *
+ * This never takes input past the delimiter from descriptors that can
+ * neither seek back nor be looked into, such as terminals.
+ *
+ * Return: As for read_pipe().
+ */
+int read_bytes(readopts_t *o, strbuf_t *sb)
+{
+	ssize_t n;
+	char c;
+	int ret;
+
+	while (o->max < 0 || sb->len < (size_t)o->max)
+	{
+		ret = read_wait(o);
+		if (ret)
+			return (ret);
+		n = read(o->fd, &c, 1);
+		if (n <= 0)
+			return (n ? -1 : 1);
+		if (c == o->delim)
+			return (0);
+		sb_addc(sb, c);
+	}
+	return (3);
+}
+
+/**
+ * read_wait - Waits for input until the timeout of a read command.
+ * @o: The options of the command.
+ *
+ * Return: 0 once there is input or without a timeout, 2 when it runs
+ *         out, -1 on error.
+ */
+int read_wait(readopts_t *o)
+{
+	struct pollfd p;
+	long left;
+	int n;
+
+	if (o->timeout <= 0)
+		return (0);
+	p.fd = o->fd, p.events = POLLIN;
+	left = o->deadline - read_now();
+	n = poll(&p, 1, left > 0 ? left : 0);
+	return (n == 1 ? 0 : n ? -1 : 2);
+}
@@ -0,0 +1,136 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+#include <time.h>
+
+/**
+ * readahead_get - Finds the read-ahead buffer of a regular file.
+ * @info: The parameter struct holding the buffers.
+ * @fd: The descriptor read.
+ * @st: The file's status.
+ *
+ * The buffer is only used again while it holds the current offset of
+ * the same, unchanged file; otherwise it is emptied and starts there.
+ *
+ * Return: The buffer, with its pos at the file offset, or NULL if the
+ *         file cannot seek or allocation fails.
+ */
+readahead_t *readahead_get(info_t *info, int fd, struct stat *st)
+{
+	off_t cur = lseek(fd, 0, SEEK_CUR);
+	readahead_t *ra;
+
+	if (cur == -1)
+		return (NULL);
+	for (ra = info->readahead; ra && ra->fd != fd; ra = ra->next)
+		;
+	if (!ra)
+	{
+		ra = malloc(sizeof(readahead_t));
+		if (!ra)
+			return (NULL);
+		memset(ra, 0, sizeof(readahead_t));
+		ra->buf = malloc(READ_AHEAD);
+		if (!ra->buf)
+			return (free(ra), NULL);
+		ra->fd = fd;
+		ra->next = info->readahead;
+		info->readahead = ra;
+	}
+	if (ra->dev != st->st_dev || ra->ino != st->st_ino ||
+			ra->size != st->st_size || ra->mtime != st->st_mtim.tv_sec ||
+			ra->mtime_ns != st->st_mtim.tv_nsec || cur < ra->off ||
+			cur > ra->off + (off_t)ra->len)
+		ra->off = cur, ra->len = 0;
+	ra->dev = st->st_dev, ra->ino = st->st_ino, ra->size = st->st_size;
+	ra->mtime = st->st_mtim.tv_sec, ra->mtime_ns = st->st_mtim.tv_nsec;
+	ra->pos = cur - ra->off;
+	return (ra);
+}
+
+/**
+ * readahead_free - Frees the read-ahead buffers and the peek pipe.
+ * @info: The parameter struct holding them.
+ */
+void readahead_free(info_t *info)
+{
+	readahead_t *ra;
+
+	while (info->readahead)
+	{
+		ra = info->readahead;
+		info->readahead = ra->next;
+		free(ra->buf);
+		free(ra);
+	}
+	if (info->peekpid)
+		close(info->peek[0]), close(info->peek[1]);
+	info->peekpid = 0;
+}
+
+/**
+ * read_peek - Makes the pipe read_pipe() copies input into.
+ * @info: The parameter struct holding the peek pipe.
+ *
+ * A child makes its own rather than share the one it inherited.
+ *
+ * Return: 0 on success, -1 on failure.
+ */
+int read_peek(info_t *info)
+{
+	pid_t pid = getpid();
+	int fds[2];
+
+	if (info->peekpid == pid)
+		return (0);
+	if (info->peekpid)
+		close(info->peek[0]), close(info->peek[1]);
+	info->peekpid = 0;
+	if (pipe2(fds, O_CLOEXEC))
+		return (-1);
+	info->peek[0] = fcntl(fds[0], F_DUPFD_CLOEXEC, REDIR_FDS);
+	info->peek[1] = fcntl(fds[1], F_DUPFD_CLOEXEC, REDIR_FDS);
+	close(fds[0]), close(fds[1]);
+	if (info->peek[0] == -1 || info->peek[1] == -1)
+		return (close(info->peek[0]), close(info->peek[1]), -1);
+	info->peekpid = pid;
+	return (0);
+}
+
+/**
+ * read_unescape - Removes the backslash escapes from the input read.
+ * @sb: The input; a backslash left at its end is dropped.
+ *
+ * Return: An array marking the bytes of the result that were escaped,
+ *         or NULL if allocation fails.
+ */
+char *read_unescape(strbuf_t *sb)
+{
+	char *esc = malloc(sb->len + 1), *s = sb->s;
+	size_t a, b;
+
+	if (!esc)
+		return (NULL);
+	for (a = b = 0; a < sb->len; a++, b++)
+	{
+		esc[b] = s[a] == '\\';
+		if (esc[b] && ++a == sb->len)
+			break;
+		s[b] = s[a];
+	}
+	s[b] = '\0';
+	sb->len = b;
+	return (esc);
+}
+
+/**
+ * read_now - Reads the clock read timeouts are measured on.
+ *
+ * Return: The CLOCK_MONOTONIC time in milliseconds.
+ */
+long read_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
@@ -0,0 +1,153 @@
+#include "myshell.h"
+
+/**
+ * redir_apply - Sets up the redirections of a command.
+ * @info: The parameter struct holding the shell variables.
+ * @redirs: The redirections (see parse_redir()).
+ * @saved: Receives, for each of the first REDIR_FDS descriptors, a
+ *         close-on-exec copy of what it was, -1 if it was closed, or -2
+ *         if it was left alone; pass it to redir_done() afterwards.
+ *
+ * The redirections are made in the shell itself, so builtins and
+ * functions see them too, and children inherit them. Output the shell
+ * has buffered is written out first. 'N>&-' on a coprocess pipe closes
+ * it for good, as that descriptor is not one a command can redirect.
+ *
+ * Return: 0 on success, -1 after undoing them if one fails.
+ */
+int redir_apply(info_t *info, char **redirs, int *saved)
+{
+	int a, fd, src;
+	char *op;
+
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	for (a = 0; a < REDIR_FDS; a++)
+		saved[a] = -2;
+	for (a = 0; redirs[a]; a++)
+	{
+		if (*redirs[a] == '{')
+		{
+			if (redir_named(info, redirs[a]))
+				return (redir_restore(saved), -1);
+			continue;
+		}
+		fd = strtol(redirs[a], &op, 10);
+		if (fd >= REDIR_FDS && !strcmp(op, "d-") && coproc_close(info, fd))
+			continue;
+		if (fd >= REDIR_FDS)
+			fprintf(stderr, "%s: %d: %d: Bad file descriptor\n",
+					info->fname, info->line_count, fd);
+		else if (saved[fd] == -2)
+			saved[fd] = fcntl(fd, F_DUPFD_CLOEXEC, REDIR_FDS);
+		src = fd < REDIR_FDS ? redir_open(info, op) : -1;
+		if (src == -1)
+		{
+			redir_restore(saved);
+			return (-1);
+		}
+		if (src == -2)
+			close(fd);
+		else if (src != fd)
+		{
+			dup2(src, fd);
+			close(src);
+		}
+	}
+	return (0);
+}
+
+/**
+ * redir_restore - Undoes the redirections of a command.
+ * @saved: The descriptors saved by redir_apply().
+ */
+void redir_restore(int *saved)
+{
+	int fd;
+
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	for (fd = 0; fd < REDIR_FDS; fd++)
+		if (saved[fd] >= 0)
+		{
+			dup2(saved[fd], fd);
+			close(saved[fd]);
+		}
+		else if (saved[fd] == -1)
+			close(fd);
+}
+
+/**
+ * redir_open - Opens the source of one redirection.
+ * @info: The parameter struct holding the shell variables.
+ * @op: The redirection after its descriptor number: its kind letter
+ *      followed by its operand.
+ *
+ * Return: A new descriptor, -2 if the descriptor is to be closed, or -1
+ *         on failure.
+ */
+int redir_open(info_t *info, char *op)
+{
+	char *text, *s;
+	size_t len;
+	int fd;
+
+	if (str_chr("rwabd", *op))
+		return (redir_file(info, op));
+	if (*op == 'h')
+		return (redir_feed(op + 1, strlen(op + 1)));
+	text = *op == 'H' ? heredoc_expand(info, op + 1) :
+		expand_string(info, op + 1, strlen(op + 1));
+	if (!text)
+		return (-1);
+	len = strlen(text);
+	if (*op == 'S') /* a here-string ends in a newline */
+	{
+		s = realloc(text, len + 2);
+		if (!s)
+			return (free(text), -1);
+		text = s;
+		text[len++] = '\n';
+		text[len] = '\0';
+	}
+	fd = redir_feed(text, len);
+	free(text);
+	return (fd);
+}
+
+/**
+ * heredoc_expand - Expands the body of a here-document.
+ * @info: The parameter struct holding the shell variables.
+ * @body: The body as written.
+ *
+ * The body expands as if it were inside double quotes, except that a
+ * double quote is an ordinary character and backslash-newline joins
+ * lines.
+ *
+ * Return: The expanded body, newly allocated, or NULL on failure.
+ */
+char *heredoc_expand(info_t *info, const char *body)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	char *text;
+
+	sb_addc(&sb, '"');
+	for (; *body; body++)
+	{
+		if (*body == '\\' && body[1] == '\n')
+			body++;
+		else if (*body == '"')
+			sb_add(&sb, "\\\"", 2);
+		else if (*body == '\\' && body[1] == '"') /* stays \" */
+			sb_add(&sb, "\\\\\\\"", 4), body++;
+		else if (*body == '\\' && body[1] && str_chr("$`\\", body[1]))
+			sb_add(&sb, body, 2), body++;
+		else
+			sb_addc(&sb, *body);
+	}
+	if (sb_addc(&sb, '"'))
+		return (free(sb.s), NULL);
+	text = expand_string(info, sb.s, sb.len);
+	free(sb.s);
+	return (text);
+}
@@ -0,0 +1,100 @@
+#define _GNU_SOURCE
+#include "myshell.h"
+
+/**
+ * redir_feed - Makes a descriptor to read a string from.
+ * @text: The string.
+ * @len: Its length.
+ *
+ * A string that fits in a pipe is written into one, so it is copied into
+ * the kernel once and read straight out of it. A larger one goes into a
+ * memfd_create() file, which lives in memory like the pipe but has no
+ * size limit. Nothing touches the disk either way.
+ *
+ * Return: The descriptor, positioned at the start, or -1 on failure.
+ */
+int redir_feed(const char *text, size_t len)
+{
+	int fds[2], fd, size;
+
+	if (!pipe(fds))
+	{
+		size = fcntl(fds[1], F_GETPIPE_SZ);
+		if (size >= 0 && len <= (size_t)size &&
+				write(fds[1], text, len) == (ssize_t)len)
+		{
+			close(fds[1]);
+			return (fds[0]);
+		}
+		close(fds[0]);
+		close(fds[1]);
+	}
+	fd = memfd_create("hsh-heredoc", MFD_CLOEXEC);
+	if (fd == -1)
+		return (redir_writer(text, len));
+	if (redir_write(fd, text, len) || lseek(fd, 0, SEEK_SET) == -1)
+	{
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/**
+ * redir_writer - Feeds a string through a pipe from another process.
+ * @text: The string.
+ * @len: Its length.
+ *
+ * This is the fallback for kernels without memfd_create(). The writer is
+ * a grandchild, so it never has to be waited for.
+ *
+ * Return: The read end of the pipe, or -1 on failure.
+ */
+int redir_writer(const char *text, size_t len)
+{
+	int fds[2];
+	pid_t pid;
+
+	if (pipe(fds))
+		return (-1);
+	pid = fork();
+	if (!pid)
+	{
+		close(fds[0]);
+		if (!fork())
+			_exit(redir_write(fds[1], text, len) ? 1 : 0);
+		_exit(0);
+	}
+	close(fds[1]);
+	if (pid == -1)
+	{
+		close(fds[0]);
+		return (-1);
+	}
+	waitpid(pid, NULL, 0);
+	return (fds[0]);
+}
+
+/**
+ * redir_write - Writes a whole string to a descriptor.
+ * @fd: The descriptor.
+ * @text: The string.
+ * @len: Its length.
+ *
+ * Return: 0 on success, -1 on failure.
+ */
+int redir_write(int fd, const char *text, size_t len)
+{
+	ssize_t n;
+
+	while (len)
+	{
+		n = write(fd, text, len);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return (-1);
+		text += n, len -= n;
+	}
+	return (0);
+}
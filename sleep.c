@@ -0,0 +1,172 @@
+#include "myshell.h"
+#include <poll.h>
+#include <sys/timerfd.h>
+
+/**
+ * sleep_cmd - Waits for a while.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: sleep number[smhd]...
+ * The times are added up, and may have fractions. The wait is a poll()
+ * on a timerfd rather than a sleep program, so a polling loop starts no
+ * process; Ctrl-C ends it early, once handle_sign() has run. A time it
+ * does not understand hands the command over to the sleep program.
+ *
+ * Return: 0 once the time is up, 128 + SIGINT if interrupted, 1 on
+ *         failure, or -1 to run the sleep program instead.
+ */
+int sleep_cmd(info_t *info)
+{
+	double secs = 0, t;
+	int a, tfd, ret;
+
+	if (info->argc < 2)
+		return (-1);
+	for (a = 1; a < info->argc; a++)
+		if (sleep_parse(info->argv[a], &t))
+			return (-1);
+		else
+			secs += t;
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	tfd = sleep_timer(secs);
+	if (tfd == -1)
+	{
+		printErro(info, strerror(errno));
+		return (1);
+	}
+	ret = sleep_wait(tfd, -1);
+	if (tfd >= 0)
+		close(tfd);
+	return (ret == -1 ? 128 + SIGINT : ret == -2);
+}
+
+/**
+ * sleep_parse - Parses a time of sleep or waitfor.
+ * @arg: A number of seconds, with an optional fraction and unit suffix:
+ *       s for seconds, m for minutes, h for hours, d for days.
+ * @secs: Receives the time in seconds; "inf" waits for ever.
+ *
+ * Return: 0 on success, -1 if @arg is not a time.
+ */
+int sleep_parse(char *arg, double *secs)
+{
+	static const char units[] = "smhd";
+	static const double scale[] = {1, 60, 3600, 86400};
+	char *end, *u;
+
+	if (!*arg || *arg == '-' || *arg == '+' || *arg == ' ')
+		return (-1);
+	*secs = strtod(arg, &end);
+	if (end == arg || *secs != *secs)
+		return (-1);
+	if (*end && (u = str_chr((char *)units, *end)))
+		*secs *= scale[u - units], end++;
+	return (*end ? -1 : 0);
+}
+
+/**
+ * sleep_timer - Starts a timer that expires after a while.
+ * @secs: The time in seconds.
+ *
+ * Return: A timerfd that becomes readable when the time is up, -2 for a
+ *         time too long to ever run out, or -1 on failure with errno set.
+ */
+int sleep_timer(double secs)
+{
+	struct itimerspec its;
+	int tfd;
+
+	if (secs >= LONG_MAX)
+		return (-2);
+	memset(&its, 0, sizeof(its));
+	its.it_value.tv_sec = secs;
+	its.it_value.tv_nsec = (secs - its.it_value.tv_sec) * 1e9;
+	if (!its.it_value.tv_sec && !its.it_value.tv_nsec)
+		its.it_value.tv_nsec = 1; /* a zero time would disarm the timer */
+	tfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (tfd != -1 && timerfd_settime(tfd, 0, &its, NULL))
+	{
+		close(tfd);
+		tfd = -1;
+	}
+	return (tfd);
+}
+
+/**
+ * sleep_wait - Waits for a timer or a descriptor.
+ * @tfd: The timer, negative for none.
+ * @fd: Another descriptor to wait for, -1 for none.
+ *
+ * poll() is never restarted after a signal handler, so Ctrl-C ends the
+ * wait as soon as handle_sign() returns.
+ *
+ * Return: 0 when the timer expired, 1 when @fd is readable, -1 if
+ *         interrupted, or -2 on failure.
+ */
+int sleep_wait(int tfd, int fd)
+{
+	struct pollfd p[2];
+	int n = 0;
+
+	if (tfd >= 0)
+		p[n].fd = tfd, p[n++].events = POLLIN;
+	if (fd >= 0)
+		p[n].fd = fd, p[n++].events = POLLIN;
+	if (poll(p, n, -1) == -1)
+		return (errno == EINTR ? -1 : -2);
+	return (tfd >= 0 && p[0].revents ? 0 : 1);
+}
+
+/**
+ * waitfor_cmd - Waits for a file to appear or change.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: waitfor [-m] [-t time] file
+ * Without -m the wait ends as soon as the file exists; with -m once it
+ * is created, written, renamed over or has its attributes changed. The
+ * shell blocks on inotify meanwhile, so it burns no CPU and starts no
+ * process, unlike a loop of test and sleep. The time is given as for
+ * sleep.
+ *
+ * Return: 0 when the file appeared or changed, 1 when the time ran out
+ *         or on failure, 2 on a usage error, 128 + SIGINT if interrupted.
+ */
+int waitfor_cmd(info_t *info)
+{
+	char **argv = info->argv;
+	double t = -1;
+	int a, modify = 0, tfd = -2, ifd, parent, r, ret;
+
+	for (a = 1; argv[a] && argv[a][0] == '-' && argv[a][1]; a++)
+		if (!strcmp(argv[a], "-m"))
+			modify = 1;
+		else if (!strcmp(argv[a], "-t") && argv[a + 1] &&
+				!sleep_parse(argv[a + 1], &t))
+			a++;
+		else
+			break;
+	if (!argv[a] || argv[a + 1] || (argv[a][0] == '-' && argv[a][1]))
+		return (printErro(info, "usage: waitfor [-m] [-t time] file"), 2);
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	if (t >= 0 && (tfd = sleep_timer(t)) == -1)
+		return (printErro(info, strerror(errno)), 1);
+	for (ret = -1; ret == -1; modify = 0) /* after a missing directory came */
+	{
+		ifd = waitfor_watch(info, argv[a], !modify, &parent);
+		if (ifd < 0)
+		{
+			ret = ifd == -2 ? 0 : 1;
+			break;
+		}
+		while ((r = sleep_wait(tfd, ifd)) == 1 && parent &&
+				!waitfor_event(ifd, argv[a]))
+			;
+		ret = r == 1 ? (parent ? 0 : -1) : r == -1 ? 128 + SIGINT : 1;
+		close(ifd);
+	}
+	if (tfd >= 0)
+		close(tfd);
+	return (ret);
+}
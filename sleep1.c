@@ -0,0 +1,83 @@
+#include "myshell.h"
+#include <sys/inotify.h>
+
+/**
+ * waitfor_watch - Starts watching for a file to appear or change.
+ * @info: The parameter struct.
+ * @path: The file.
+ * @exists: Set if the file existing already ends the wait.
+ * @parent: Receives 1 if the directory holding @path is watched, 0 if
+ *          that is missing and the nearest existing one above is
+ *          watched instead, for the missing one to be created.
+ *
+ * The file is looked for only once the watch is in place, so it cannot
+ * appear unseen in between.
+ *
+ * Return: An inotify descriptor, -2 if the file exists and @exists is
+ *         set, or -1 after reporting a failure.
+ */
+int waitfor_watch(info_t *info, char *path, int exists, int *parent)
+{
+	char *dir = dupStrn(path), *slash;
+	int fd = inotify_init1(IN_CLOEXEC), wd = -1;
+	struct stat st;
+
+	*parent = 1;
+	while (dir && fd != -1 && wd == -1)
+	{
+		slash = strrchr(dir, '/');
+		if (!slash)
+			memcpy(dir, ".", 2);
+		else
+			slash[slash == dir] = '\0';
+		wd = inotify_add_watch(fd, dir, IN_CREATE | IN_MOVED_TO | IN_MODIFY |
+				IN_CLOSE_WRITE | IN_ATTRIB);
+		if (wd == -1 && (errno != ENOENT || !strcmp(dir, ".") ||
+					!strcmp(dir, "/")))
+			break;
+		*parent &= wd != -1;
+	}
+	if (wd == -1)
+	{
+		fprintf(stderr, "%s: %d: waitfor: %s: %s\n", info->fname,
+				info->line_count, dir ? dir : path, strerror(errno));
+		if (fd != -1)
+			close(fd);
+		fd = -1;
+	}
+	else if (exists && !stat(path, &st))
+	{
+		close(fd);
+		fd = -2;
+	}
+	free(dir);
+	return (fd);
+}
+
+/**
+ * waitfor_event - Checks whether inotify events name a file.
+ * @fd: The inotify descriptor watching the file's directory.
+ * @path: The file.
+ *
+ * Return: 1 if an event was about the file, or events were lost, 0 if
+ *         they were all about other files.
+ */
+int waitfor_event(int fd, char *path)
+{
+	union
+	{
+		struct inotify_event e;
+		char buf[4096];
+	} u;
+	struct inotify_event *e;
+	char *base = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+	ssize_t n = read(fd, u.buf, sizeof(u.buf)), k;
+
+	for (k = 0; k < n; k += sizeof(*e) + e->len)
+	{
+		e = (struct inotify_event *)(u.buf + k);
+		if (e->mask & IN_Q_OVERFLOW || (e->len && !strcmp(e->name, base)))
+			return (1);
+	}
+	return (0);
+}
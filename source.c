@@ -0,0 +1,173 @@
+#include "myshell.h"
+
+/**
+ * source_cmd - Runs a file in the current shell.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: source FILE [ARG...] (also '.'); the ARGs become $1, $2, ...
+ * while the file runs. 'return' leaves the file early.
+ *
+ * Return: The status of the last command run, 1 if the file cannot be
+ *         read, or 2 on a syntax error.
+ */
+int source_cmd(info_t *info)
+{
+	char **argv = info->argv, **assignv = info->assignv, **posv = info->posv;
+	int argc = info->argc, assigns = info->assigns, posc = info->posc;
+	int loops = info->loops;
+	char *path;
+	prog_t *prog;
+
+	if (!argv[1])
+	{
+		printErro(info, "filename argument required");
+		return (2);
+	}
+	if (info->sourced + info->depth >= FUNC_MAX_DEPTH)
+	{
+		printErro(info, "maximum nesting level exceeded");
+		return (1);
+	}
+	path = source_find(info, argv[1]);
+	prog = source_load(info, path);
+	free(path);
+	if (!prog)
+		return (info->status);
+	if (argc > 2)
+		info->posv = argv + 2, info->posc = argc - 2;
+	info->argv = info->assignv = NULL;
+	info->argc = info->assigns = info->loops = 0;
+	info->sourced++;
+	vm_run(info, prog);
+	info->sourced--;
+	info->unwind &= ~UNWIND_RETURN;
+	info->argv = argv, info->assignv = assignv, info->posv = posv;
+	info->argc = argc, info->assigns = assigns, info->posc = posc;
+	info->loops = loops;
+	return (info->status);
+}
+
+/**
+ * source_find - Finds the file to source.
+ * @info: The parameter struct holding the shell variables.
+ * @name: The file name given; one without a '/' is looked for in PATH
+ *        first, then in the current directory.
+ *
+ * Return: The allocated file name, or NULL if allocation fails.
+ */
+char *source_find(info_t *info, char *name)
+{
+	char *dirs = var_value(info, "PATH", 4), *path;
+	struct stat st;
+	size_t n;
+
+	while (!str_chr(name, '/') && dirs && *dirs)
+	{
+		n = strcspn(dirs, ":");
+		path = malloc(n + lenstrn(name) + 2);
+		if (!path)
+			return (NULL);
+		memcpy(path, dirs, n);
+		path[n] = '\0';
+		catstrn(path, n ? "/" : "");
+		catstrn(path, name);
+		if (!stat(path, &st) && S_ISREG(st.st_mode) && !access(path, R_OK))
+			return (path);
+		free(path);
+		dirs += n + (dirs[n] == ':');
+	}
+	return (dupStrn(name));
+}
+
+/**
+ * source_load - Compiles a file to source, or reuses its compiled form.
+ * @info: The parameter struct holding the compiled files.
+ * @path: The file; may be NULL.
+ *
+ * A file is compiled again only when its modification time or size has
+ * changed, so a file sourced in a loop is parsed once.
+ *
+ * Return: The program (owned by the cache), or NULL if the file cannot be
+ *         read (info->status is then 1) or has a syntax error (2).
+ */
+prog_t *source_load(info_t *info, char *path)
+{
+	srcfile_t *f;
+	struct stat st;
+	int fresh, fd = path ? open(path, O_RDONLY) : -1;
+	char *map = NULL;
+
+	if (fd == -1 || fstat(fd, &st) || !S_ISREG(st.st_mode))
+	{
+		fprintf(stderr, "%s: %d: %s: cannot open %s\n", info->fname,
+				info->line_count, info->argv[0], info->argv[1]);
+		if (fd != -1)
+			close(fd);
+		return (info->status = 1, NULL);
+	}
+	f = source_entry(info, path);
+	fresh = f && f->prog && f->mtime == st.st_mtim.tv_sec &&
+		f->mtime_ns == st.st_mtim.tv_nsec && f->size == st.st_size;
+	cache_count(info, fresh);
+	if (f && !fresh && st.st_size)
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (!f || map == MAP_FAILED)
+		return (info->status = 1, NULL);
+	if (!fresh)
+	{
+		prog_free(f->prog);
+		f->prog = script_compile(info, map ? map : "", st.st_size);
+		f->mtime = st.st_mtim.tv_sec;
+		f->mtime_ns = st.st_mtim.tv_nsec;
+		f->size = st.st_size;
+	}
+	if (map)
+		munmap(map, st.st_size);
+	return (f->prog ? f->prog : (info->status = 2, NULL));
+}
+
+/**
+ * source_entry - Finds or adds the cache entry of a file to source.
+ * @info: The parameter struct holding the compiled files.
+ * @path: The file.
+ *
+ * Return: The entry (with no program yet if it is new), or NULL if
+ *         allocation fails.
+ */
+srcfile_t *source_entry(info_t *info, char *path)
+{
+	srcfile_t *f;
+
+	for (f = info->sources; f; f = f->next)
+		if (!strcmp(f->path, path))
+			return (f);
+	f = malloc(sizeof(srcfile_t));
+	if (!f)
+		return (NULL);
+	memset(f, 0, sizeof(srcfile_t));
+	f->path = dupStrn(path);
+	if (!f->path)
+		return (free(f), NULL);
+	f->next = info->sources;
+	info->sources = f;
+	return (f);
+}
+
+/**
+ * sources_free - Frees the compiled files kept by 'source'.
+ * @info: The parameter struct holding them.
+ */
+void sources_free(info_t *info)
+{
+	srcfile_t *f, *next;
+
+	for (f = info->sources; f; f = next)
+	{
+		next = f->next;
+		prog_free(f->prog);
+		free(f->path);
+		free(f);
+	}
+	info->sources = NULL;
+}
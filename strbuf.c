@@ -0,0 +1,105 @@
+#include "myshell.h"
+
+/**
+ * sb_grow - Makes room for more bytes in a string builder.
+ * @sb: The string builder.
+ * @extra: The number of bytes about to be appended.
+ *
+ * The capacity doubles, so appending n bytes one at a time is O(n).
+ *
+ * Return: 0 on success, -1 if allocation fails.
+ */
+int sb_grow(strbuf_t *sb, size_t extra)
+{
+	size_t cap = sb->cap ? sb->cap : 64;
+	char *s;
+
+	while (cap < sb->len + extra + 1)
+		cap *= 2;
+	if (cap == sb->cap)
+		return (0);
+	s = realloc(sb->s, cap);
+	if (!s)
+		return (-1);
+	sb->s = s;
+	sb->cap = cap;
+	return (0);
+}
+
+/**
+ * sb_add - Appends bytes to a string builder.
+ * @sb: The string builder.
+ * @s: The bytes to append.
+ * @n: The number of bytes to append.
+ *
+ * Return: 0 on success, -1 if allocation fails.
+ */
+int sb_add(strbuf_t *sb, const char *s, size_t n)
+{
+	if (sb_grow(sb, n))
+		return (-1);
+	memcpy(sb->s + sb->len, s, n);
+	sb->len += n;
+	sb->s[sb->len] = '\0';
+	return (0);
+}
+
+/**
+ * sb_addc - Appends one character to a string builder.
+ * @sb: The string builder.
+ * @c: The character to append.
+ *
+ * Return: 0 on success, -1 if allocation fails.
+ */
+int sb_addc(strbuf_t *sb, char c)
+{
+	return (sb_add(sb, &c, 1));
+}
+
+/**
+ * sb_take - Hands the built string over to the caller.
+ * @sb: The string builder; it is left empty and reusable.
+ *
+ * Return: The NUL-terminated string (never NULL unless allocation failed).
+ */
+char *sb_take(strbuf_t *sb)
+{
+	char *s;
+
+	if (!sb->s && sb_grow(sb, 0))
+		return (NULL);
+	if (!sb->len)
+		sb->s[0] = '\0';
+	s = sb->s;
+	sb->s = NULL;
+	sb->len = sb->cap = 0;
+	return (s);
+}
+
+/**
+ * wl_push - Appends a word to a word list.
+ * @wl: The word list; its vector stays NULL-terminated.
+ * @word: The word; ownership passes to the list. NULL is ignored.
+ *
+ * Return: 0 on success, -1 if allocation fails (@word is freed).
+ */
+int wl_push(wordlist_t *wl, char *word)
+{
+	char **v;
+	size_t cap;
+
+	if (!word)
+		return (-1);
+	if (wl->n + 1 >= wl->cap)
+	{
+		cap = wl->cap ? wl->cap * 2 : 8;
+		v = realloc(wl->v, sizeof(char *) * cap);
+		if (!v)
+			return (free(word), -1);
+		wl->v = v;
+		wl->cap = cap;
+	}
+	wl->v[wl->n++] = word;
+	wl->v[wl->n] = NULL;
+	return (0);
+}
@@ -0,0 +1,143 @@
+#include "myshell.h"
+
+/**
+ * var_hash - Computes the FNV-1a hash of a variable name.
+ * @name: The name to hash; it need not be NUL-terminated.
+ * @len: The number of bytes of @name to hash.
+ *
+ * Return: The 32-bit hash of the name.
+ */
+unsigned int var_hash(const char *name, size_t len)
+{
+	unsigned int h = 2166136261u;
+	size_t a;
+
+	for (a = 0; a < len; a++)
+	{
+		h ^= (unsigned char)name[a];
+		h *= 16777619u;
+	}
+	return (h);
+}
+
+/**
+ * symtab_new - Allocates an empty variable scope.
+ * @parent: The enclosing scope, or NULL for the global scope.
+ * @size: The initial number of buckets (must be a power of two).
+ *
+ * Return: The new scope, or NULL if allocation fails.
+ */
+symtab_t *symtab_new(symtab_t *parent, size_t size)
+{
+	symtab_t *tab = malloc(sizeof(symtab_t));
+
+	if (!tab)
+		return (NULL);
+	tab->bucket = malloc(sizeof(var_t *) * size);
+	if (!tab->bucket)
+	{
+		free(tab);
+		return (NULL);
+	}
+	memset(tab->bucket, 0, sizeof(var_t *) * size);
+	tab->size = size;
+	tab->count = 0;
+	tab->parent = parent;
+	return (tab);
+}
+
+/**
+ * symtab_free - Frees one scope and every variable it holds.
+ * @tab: The scope to free.
+ *
+ * Return: The enclosing scope of @tab.
+ */
+symtab_t *symtab_free(symtab_t *tab)
+{
+	symtab_t *parent;
+	var_t *v, *next;
+	size_t a;
+
+	if (!tab)
+		return (NULL);
+	for (a = 0; a < tab->size; a++)
+		for (v = tab->bucket[a]; v; v = next)
+		{
+			next = v->next;
+			array_free(v->array);
+			free(v->pair);
+			free(v);
+		}
+	parent = tab->parent;
+	free(tab->bucket);
+	free(tab);
+	return (parent);
+}
+
+/**
+ * symtab_grow - Doubles the bucket count of a scope and rehashes it.
+ * @tab: The scope to grow.
+ *
+ * Each variable keeps its cached hash, so no name is hashed again.
+ *
+ * Return: 0 on success, -1 if allocation fails (the table is unchanged).
+ */
+int symtab_grow(symtab_t *tab)
+{
+	var_t **bucket, *v, *next;
+	size_t a, size = tab->size * 2;
+
+	bucket = malloc(sizeof(var_t *) * size);
+	if (!bucket)
+		return (-1);
+	memset(bucket, 0, sizeof(var_t *) * size);
+	for (a = 0; a < tab->size; a++)
+		for (v = tab->bucket[a]; v; v = next)
+		{
+			next = v->next;
+			v->next = bucket[v->hash & (size - 1)];
+			bucket[v->hash & (size - 1)] = v;
+		}
+	free(tab->bucket);
+	tab->bucket = bucket;
+	tab->size = size;
+	return (0);
+}
+
+/**
+ * symtab_insert - Adds a new variable to a scope.
+ * @tab: The scope receiving the variable.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ * @value: The initial value, or NULL to declare the name without a value.
+ * @flags: The initial VAR_* attribute bits.
+ *
+ * The caller must already know that @name is not present in @tab.
+ *
+ * Return: The new variable, or NULL if allocation fails.
+ */
+var_t *symtab_insert(symtab_t *tab, const char *name, size_t len,
+		const char *value, int flags)
+{
+	var_t *v;
+
+	if (tab->count >= tab->size)
+		symtab_grow(tab); /* keep the load factor at or below one */
+	v = malloc(sizeof(var_t));
+	if (!v)
+		return (NULL);
+	v->pair = var_pair(name, len, value);
+	if (!v->pair)
+	{
+		free(v);
+		return (NULL);
+	}
+	v->namelen = len;
+	v->array = NULL;
+	v->hash = var_hash(name, len);
+	v->flags = value ? flags : flags | VAR_NOVALUE;
+	v->next = tab->bucket[v->hash & (tab->size - 1)];
+	tab->bucket[v->hash & (tab->size - 1)] = v;
+	tab->count++;
+	return (v);
+}
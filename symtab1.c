@@ -0,0 +1,158 @@
+#include "myshell.h"
+
+/**
+ * var_pair - Builds the "NAME=value" string stored for a variable.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ * @value: The value, or NULL for an empty value.
+ *
+ * Return: A newly allocated "NAME=value" string, or NULL on failure.
+ */
+char *var_pair(const char *name, size_t len, const char *value)
+{
+	size_t vlen = value ? strlen(value) : 0;
+	char *pair = malloc(len + vlen + 2);
+
+	if (!pair)
+		return (NULL);
+	memcpy(pair, name, len);
+	pair[len] = '=';
+	memcpy(pair + len + 1, value ? value : "", vlen + 1);
+	return (pair);
+}
+
+/**
+ * var_find - Looks a name up in a single scope.
+ * @tab: The scope to search.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ * @hash: var_hash() of @name.
+ *
+ * Return: The variable, or NULL if @tab does not hold it.
+ */
+var_t *var_find(symtab_t *tab, const char *name, size_t len, unsigned int hash)
+{
+	var_t *v;
+
+	for (v = tab->bucket[hash & (tab->size - 1)]; v; v = v->next)
+		if (v->hash == hash && v->namelen == len && !strncmp(v->pair, name, len))
+			return (v);
+	return (NULL);
+}
+
+/**
+ * var_lookup - Finds the visible variable for a name.
+ * @info: The shell state holding the scope chain.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ *
+ * Scopes are searched from the innermost function scope out to the
+ * globals, so a 'local' shadows any outer variable of the same name.
+ *
+ * Return: The variable, or NULL if no scope holds it.
+ */
+var_t *var_lookup(info_t *info, const char *name, size_t len)
+{
+	unsigned int hash = var_hash(name, len);
+	symtab_t *tab;
+	var_t *v;
+
+	for (tab = info->vars; tab; tab = tab->parent)
+	{
+		v = var_find(tab, name, len, hash);
+		if (v)
+			return (v);
+	}
+	return (NULL);
+}
+
+/**
+ * var_set - Assigns a value and/or attributes to a variable.
+ * @info: The shell state holding the scope chain.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ * @value: The new value, or NULL to keep the current one.
+ * @flags: VAR_* attribute bits to add to the variable.
+ *
+ * The visible variable is updated in whatever scope holds it; a name that
+ * is not yet defined is created in the global scope.
+ *
+ * Return: The variable, or NULL if it is readonly or allocation fails.
+ */
+var_t *var_set(info_t *info, const char *name, size_t len,
+		const char *value, int flags)
+{
+	var_t *v = var_lookup(info, name, len);
+	symtab_t *tab;
+	char *pair;
+
+	if (!v)
+	{
+		for (tab = info->vars; tab->parent; tab = tab->parent)
+			;
+		v = symtab_insert(tab, name, len, value, flags);
+		if (v && (flags & VAR_EXPORT))
+			info->env_changed = 1;
+		return (v);
+	}
+	if ((v->flags & VAR_READONLY) && value)
+	{
+		fprintf(stderr, "%s: %d: %.*s: readonly variable\n",
+				info->fname, info->line_count, (int)len, name);
+		return (NULL);
+	}
+	if (value && v->array) /* NAME=value on an array sets element 0 */
+		array_set(v->array, "0", 0, dupStrn(value));
+	else if (value)
+	{
+		pair = var_pair(name, len, value);
+		if (!pair)
+			return (NULL);
+		free(v->pair);
+		v->pair = pair;
+		v->flags &= ~VAR_NOVALUE;
+	}
+	if ((v->flags | flags) & VAR_EXPORT)
+		info->env_changed = 1;
+	v->flags |= flags;
+	return (v);
+}
+
+/**
+ * var_unset - Removes the visible variable for a name.
+ * @info: The shell state holding the scope chain.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ *
+ * Return: 0 if the name is now unset, -1 if the variable is readonly.
+ */
+int var_unset(info_t *info, const char *name, size_t len)
+{
+	unsigned int hash = var_hash(name, len);
+	symtab_t *tab;
+	var_t **link, *v;
+
+	for (tab = info->vars; tab; tab = tab->parent)
+		for (link = &tab->bucket[hash & (tab->size - 1)]; *link;
+				link = &(*link)->next)
+		{
+			v = *link;
+			if (v->hash != hash || v->namelen != len || strncmp(v->pair, name, len))
+				continue;
+			if (v->flags & VAR_READONLY)
+			{
+				fprintf(stderr, "%s: %d: unset: %.*s: readonly variable\n",
+						info->fname, info->line_count, (int)len, name);
+				return (-1);
+			}
+			if (v->flags & VAR_EXPORT)
+				info->env_changed = 1;
+			*link = v->next;
+			tab->count--;
+			array_free(v->array);
+			free(v->pair);
+			free(v);
+			return (0);
+		}
+	return (0);
+}
@@ -0,0 +1,121 @@
+#include "myshell.h"
+
+/**
+ * var_value - Gets the value of the visible variable for a name.
+ * @info: The shell state holding the scope chain.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ *
+ * An array stands for its element 0, as in $array.
+ *
+ * Return: The value, or NULL if the name is unset or has no value.
+ */
+char *var_value(info_t *info, const char *name, size_t len)
+{
+	var_t *v = var_lookup(info, name, len);
+
+	if (v && v->array)
+		return (array_get(v->array, "0", 0));
+	if (!v || (v->flags & VAR_NOVALUE))
+		return (NULL);
+	return (v->pair + v->namelen + 1);
+}
+
+/**
+ * var_local - Declares a variable in the innermost function scope.
+ * @info: The shell state holding the scope chain.
+ * @name: The variable name (not necessarily NUL-terminated).
+ * @len: Length of @name.
+ * @value: The value, or NULL to declare the name without one.
+ * @flags: VAR_* attribute bits for the variable.
+ *
+ * Return: The variable, or NULL outside a function or on failure.
+ */
+var_t *var_local(info_t *info, const char *name, size_t len,
+		const char *value, int flags)
+{
+	var_t *v;
+
+	if (!info->vars->parent)
+		return (NULL); /* there is no function scope to declare into */
+	v = var_find(info->vars, name, len, var_hash(name, len));
+	if (!v)
+	{
+		if (flags & VAR_EXPORT)
+			info->env_changed = 1;
+		return (symtab_insert(info->vars, name, len, value, flags));
+	}
+	return (var_set(info, name, len, value, flags));
+}
+
+/**
+ * scope_push - Opens a new function scope for 'local' variables.
+ * @info: The shell state holding the scope chain.
+ *
+ * Return: 0 on success, -1 if allocation fails.
+ */
+int scope_push(info_t *info)
+{
+	symtab_t *tab = symtab_new(info->vars, SYMTAB_LOCAL_BUCKETS);
+
+	if (!tab)
+		return (-1);
+	info->vars = tab;
+	return (0);
+}
+
+/**
+ * scope_pop - Discards the innermost function scope.
+ * @info: The shell state holding the scope chain.
+ *
+ * The global scope is never popped.
+ */
+void scope_pop(info_t *info)
+{
+	if (!info->vars || !info->vars->parent)
+		return;
+	/* locals may have shadowed or been exported variables */
+	info->env_changed = 1;
+	info->vars = symtab_free(info->vars);
+}
+
+/**
+ * build_envp - Builds the envp array handed to child processes.
+ * @info: The shell state holding the scope chain.
+ *
+ * Only the visible exported scalars are included. The entries point at
+ * the variables' own "NAME=value" strings, so only the array itself is
+ * allocated and it must be released with free(), not free_strn().
+ *
+ * Return: The NULL-terminated envp array, or NULL on failure.
+ */
+char **build_envp(info_t *info)
+{
+	symtab_t *tab;
+	var_t *v;
+	size_t a, n = 0, pass;
+	char **envp = NULL;
+
+	for (pass = 0; pass < 2; pass++)
+	{
+		for (tab = info->vars; tab; tab = tab->parent)
+			for (a = 0; a < tab->size; a++)
+				for (v = tab->bucket[a]; v; v = v->next)
+				{
+					if ((v->flags & (VAR_EXPORT | VAR_NOVALUE)) != VAR_EXPORT ||
+						(tab != info->vars && var_lookup(info, v->pair, v->namelen) != v))
+						continue;
+					if (envp)
+						envp[n] = v->pair;
+					n++;
+				}
+		if (pass)
+			break;
+		envp = malloc(sizeof(char *) * (n + 1));
+		if (!envp)
+			return (NULL);
+		n = 0;
+	}
+	envp[n] = NULL;
+	return (envp);
+}
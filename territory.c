@@ -8,7 +8,7 @@
  * @name: Name of the environment variable to retrieve.
  *
  * This function is responsible for retrieving the value of an environment
- * variable specified by the 'name' parameter from the environment variables
+ * variable specified by the 'name' parameter from the shell variables
  * stored in the 'info' structure.
  *
  * Return: Pointer to the value of the environment variable if found,
@@ -16,17 +16,15 @@
  */
 char *get_env(info_t *info, const char *name)
 {
-	list_t *node = info->env;
+	size_t len = strlen(name);
 	char *c;
 
-	while (node)
-	{
-		/* Check for variable match */
-		c = starts_with_strn(node->str, name);
-		if (c && *c)
-			return (c);
-		node = node->next;
-	}
+	/* Callers pass "NAME=", the symbol table is keyed by NAME alone */
+	if (len && name[len - 1] == '=')
+		len--;
+	c = var_value(info, name, len);
+	if (c && *c)
+		return (c);
 	return (NULL); /* Environment variable not found */
 }
 
@@ -40,8 +38,14 @@ char *get_env(info_t *info, const char *name)
  */
 int env_cmd(info_t *info)
 {
-	/* Call the 'print_list_str' function to print the environment variables */
-	print_strList(info->env);
+	char **envp = get_environ(info);
+
+	/* Print the exported variables exactly as children receive them */
+	for (; envp && *envp; envp++)
+	{
+		prnt_strn(*envp);
+		prnt_strn("\n");
+	}
 	return (0); /* Indicate successful execution */
 }
 
@@ -63,12 +67,9 @@ int setenv_cmd(info_t *info)
 		_errputs("Wrong number of arguments\n");
 		return (1);
 	}
-	/* Call setenv_cmd function to set or modify the environment variable */
-	if (setenv(info->argv[1], info->argv[2], 1) != 0)
-	{
-		perror("setenv");
+	/* Set or modify the variable and mark it for export */
+	if (set_env(info, info->argv[1], info->argv[2]) != 0)
 		return (1);
-	}
 	return (0);
 }
 
@@ -92,33 +93,37 @@ int unsetenv_cmd(info_t *info)
 		_errputs("More arguments needed.\n");
 		return (1);
 	}
-	/* Loop true d args n call unsetenv 2 remove each environment variable */
+	/* Loop true d args n call unset_env 2 remove each environment variable */
 	for (c = 1; c < info->argc; c++)
 	{
-		if (unsetenv(info->argv[c]) != 0)
-		{
-			perror("unsetenv");
+		if (!unset_env(info, info->argv[c]))
 			return (1);
-		}
 	}
 	return (0);
 }
 
 /**
- * populateEnv_list - Populate the environment linked list.
+ * populateEnv_list - Populate the global variable scope from the environment.
  *
  * @info: Pointer to a structure containing potential arguments,
  * used to maintain a consistent function prototype.
  *
- * Return: Always 0 to indicate successful completion.
+ * Return: 0 on success, 1 if the global scope cannot be allocated.
  */
 int populateEnv_list(info_t *info)
 {
 	size_t c;
-	list_t *node = NULL; /* Initialize a linked list node */
-	/* Loop true d 'environ' array to add envmt variables 2 d linked list */
+	char *eq;
+
+	info->vars = symtab_new(NULL, SYMTAB_BUCKETS); /* The global scope */
+	if (!info->vars)
+		return (1);
+	/* Loop true d 'environ' array to add exported variables 2 d table */
 	for (c = 0; environ[c]; c++)
-		nodeadd_end(&node, environ[c], 0);
-	info->env = node;
+	{
+		eq = str_chr(environ[c], '=');
+		if (eq)
+			var_set(info, environ[c], eq - environ[c], eq + 1, VAR_EXPORT);
+	}
 	return (0); /* Indicate successful completion */
 }
@@ -0,0 +1,175 @@
+#include "myshell.h"
+#include <sys/syscall.h>
+
+/**
+ * timeout_cmd - Runs a command with a time limit.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: timeout [-s signal] [-k time] time command [args...]
+ * The shell enforces the limit itself while it waits for the command
+ * (see timeout_wait()), so no timeout program runs between them. When
+ * the time is up the command is sent the signal, SIGTERM by default, and
+ * SIGKILL -k time later if it is still running. A function or builtin
+ * runs in a child of its own so that it can be stopped as well. A time
+ * of 0 sets no limit; other options hand the command over to the
+ * timeout program.
+ *
+ * Return: The command's status, 124 if it was signalled when its time
+ *         was up, 128 + SIGKILL if it had to be killed, or -1 to run the
+ *         timeout program instead.
+ */
+int timeout_cmd(info_t *info)
+{
+	timeout_t to, *outer = info->timeout;
+	char **argv = info->argv;
+	int a = timeout_opts(info, &to), argc = info->argc;
+
+	if (a < 0)
+		return (-1);
+	info->argv = argv + a, info->argc = argc - a;
+	info->timeout = to.secs > 0 ? &to : NULL;
+	if (info->timeout && (func_find(info, info->argv[0]) ||
+				builtin_find(info->argv[0])))
+		timeout_spawn(info, &to);
+	else
+		exec_command(info, NULL);
+	info->argv = argv, info->argc = argc;
+	info->timeout = outer;
+	return (to.fired == 2 ? 128 + SIGKILL : to.fired ? 124 : info->status);
+}
+
+/**
+ * timeout_opts - Parses the options of a timeout command.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @to: Receives the limit.
+ *
+ * Return: The index of the command, or -1 for what this shell leaves to
+ *         the program.
+ */
+int timeout_opts(info_t *info, timeout_t *to)
+{
+	char **argv = info->argv, *v;
+	int a;
+
+	memset(to, 0, sizeof(*to));
+	to->sig = SIGTERM;
+	for (a = 1; argv[a] && argv[a][0] == '-' && argv[a][1]; a++)
+	{
+		if (!strcmp(argv[a], "--") && ++a)
+			break;
+		v = argv[a][2] ? argv[a] + 2 : argv[a + 1];
+		if (!v || (argv[a][1] != 's' && argv[a][1] != 'k'))
+			return (-1);
+		if (argv[a][1] == 's' && (to->sig = timeout_signal(v)) == -1)
+			return (-1);
+		if (argv[a][1] == 'k' && sleep_parse(v, &to->kill))
+			return (-1);
+		a += !argv[a][2];
+	}
+	if (!argv[a] || !argv[a + 1] || sleep_parse(argv[a], &to->secs))
+		return (-1);
+	return (a + 1);
+}
+
+/**
+ * timeout_signal - Finds the signal a timeout command sends.
+ * @name: A signal number, or a name with or without its SIG prefix.
+ *
+ * Return: The signal, or -1 for one this shell does not know.
+ */
+int timeout_signal(char *name)
+{
+	static const char *names[] = {"HUP", "INT", "QUIT", "KILL", "USR1",
+		"USR2", "PIPE", "ALRM", "TERM", "CONT", "STOP", NULL};
+	static const int sigs[] = {SIGHUP, SIGINT, SIGQUIT, SIGKILL, SIGUSR1,
+		SIGUSR2, SIGPIPE, SIGALRM, SIGTERM, SIGCONT, SIGSTOP};
+	char *end;
+	long n;
+	int k;
+
+	if (*name >= '0' && *name <= '9')
+	{
+		n = strtol(name, &end, 10);
+		return (*end || n < 1 || n >= NSIG ? -1 : (int)n);
+	}
+	if (!strncmp(name, "SIG", 3))
+		name += 3;
+	for (k = 0; names[k]; k++)
+		if (!strcmp(name, names[k]))
+			return (sigs[k]);
+	return (-1);
+}
+
+/**
+ * timeout_spawn - Runs a function or builtin under a time limit.
+ * @info: The parameter struct holding the command's 'argv'.
+ * @to: The limit.
+ *
+ * The command runs in a child leading a process group of its own, and
+ * the whole group is signalled, so the commands it started stop too.
+ */
+void timeout_spawn(info_t *info, timeout_t *to)
+{
+	pid_t pid;
+
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	pid = fork();
+	if (!pid)
+	{
+		setpgid(0, 0);
+		info->timeout = NULL;
+		exec_command(info, NULL);
+		subshell_exit(info);
+	}
+	if (pid == -1)
+	{
+		perror("Error:");
+		info->status = 1;
+		return;
+	}
+	setpgid(pid, pid); /* before any signal, whichever side runs first */
+	to->group = 1;
+	timeout_wait(info, pid);
+	info->status = WIFEXITED(info->status) ? WEXITSTATUS(info->status) :
+		128 + WTERMSIG(info->status);
+}
+
+/**
+ * timeout_wait - Waits for a child under a time limit.
+ * @info: The parameter struct; info->timeout is the limit and
+ *        info->status receives the child's wait status.
+ * @pid: The child.
+ *
+ * A pidfd for the child and a timerfd for the limit are polled together,
+ * so the wait ends as soon as either is ready; when the time is up the
+ * child is signalled and, with -k, the timer is set again for SIGKILL.
+ * Without pidfd_open() (Linux before 5.3) the child is waited for with
+ * no limit.
+ */
+void timeout_wait(info_t *info, pid_t pid)
+{
+	timeout_t *to = info->timeout;
+	int pfd = -1, tfd, r, sig;
+
+#ifdef SYS_pidfd_open
+	pfd = syscall(SYS_pidfd_open, pid, 0);
+#endif
+	tfd = pfd == -1 ? -2 : sleep_timer(to->secs);
+	while (pfd != -1 && (r = sleep_wait(tfd, pfd)) != 1 && r != -2)
+	{
+		if (r == -1) /* Ctrl-C reached the child as well */
+			continue;
+		close(tfd);
+		sig = to->fired ? SIGKILL : to->sig;
+		kill(to->group ? -pid : pid, sig);
+		to->fired = sig == SIGKILL ? 2 : 1;
+		tfd = to->fired == 1 && to->kill > 0 ? sleep_timer(to->kill) : -2;
+	}
+	if (tfd >= 0)
+		close(tfd);
+	if (pfd != -1)
+		close(pfd);
+	while (waitpid(pid, &info->status, 0) == -1 && errno == EINTR)
+		;
+}
@@ -0,0 +1,178 @@
+#include "myshell.h"
+#include <sys/resource.h>
+
+/**
+ * ulimit_cmd - Shows or sets the resource limits of the shell.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: ulimit [-SHa] [-Rcdefilmnpqrstuvx] [limit]
+ * The limits are the shell's own, set with setrlimit(), so every command
+ * started afterwards inherits them. Without an option the file size
+ * limit (-f) is meant. A limit is a number, 'unlimited', 'hard' or
+ * 'soft'; it sets the soft limit with -S, the hard one with -H and both
+ * otherwise. Shown limits are the soft ones unless -H is given.
+ *
+ * Return: 0 on success, 1 if a limit could not be read or set, 2 on a
+ *         usage error.
+ */
+int ulimit_cmd(info_t *info)
+{
+	char **argv = info->argv, opts[32] = "", *o;
+	int a, n = 0, how = 0, k, ret = 0;
+
+	for (a = 1; argv[a] && argv[a][0] == '-' && argv[a][1]; a++)
+	{
+		if (!strcmp(argv[a], "--") && ++a)
+			break;
+		for (o = argv[a] + 1; *o; o++)
+			if (*o == 'S' || *o == 'H')
+				how |= *o == 'S' ? 1 : 2;
+			else if (*o == 'a')
+				strcpy(opts, "Rcdefilmnpqrstuvx"), n = strlen(opts);
+			else if (ulimit_find(*o) && n < 31)
+				opts[n++] = *o;
+			else
+			{
+				fprintf(stderr, "%s: %d: ulimit: -%c: invalid option\n",
+						info->fname, info->line_count, *o);
+				n = -1;
+				break;
+			}
+		if (n < 0)
+			break;
+	}
+	if (n < 0 || (argv[a] && (argv[a + 1] || n > 1)))
+	{
+		printErro(info, "usage: ulimit [-SHa] [-Rcdefilmnpqrstuvx] [limit]");
+		return (2);
+	}
+	if (!n)
+		opts[n++] = 'f';
+	if (argv[a])
+		return (ulimit_set(info, ulimit_find(opts[0]), argv[a], how));
+	for (k = 0; k < n; k++)
+		ret |= ulimit_show(info, ulimit_find(opts[k]), how == 2, n > 1);
+	return (ret);
+}
+
+/**
+ * ulimit_find - Finds a resource limit by its option letter.
+ * @opt: The letter.
+ *
+ * The units are those of bash, so the numbers of a script read the same
+ * in either shell.
+ *
+ * Return: The limit, or NULL if no limit has that letter.
+ */
+ulimit_t *ulimit_find(char opt)
+{
+	static ulimit_t limits[] = {
+		{'R', RLIMIT_RTTIME, 1, "real-time non-blocking time", "microseconds"},
+		{'c', RLIMIT_CORE, 512, "core file size", "blocks"},
+		{'d', RLIMIT_DATA, 1024, "data seg size", "kbytes"},
+		{'e', RLIMIT_NICE, 1, "scheduling priority", NULL},
+		{'f', RLIMIT_FSIZE, 512, "file size", "blocks"},
+		{'i', RLIMIT_SIGPENDING, 1, "pending signals", NULL},
+		{'l', RLIMIT_MEMLOCK, 1024, "max locked memory", "kbytes"},
+		{'m', RLIMIT_RSS, 1024, "max memory size", "kbytes"},
+		{'n', RLIMIT_NOFILE, 1, "open files", NULL},
+		{'p', -1, 512, "pipe size", "512 bytes"},
+		{'q', RLIMIT_MSGQUEUE, 1, "POSIX message queues", "bytes"},
+		{'r', RLIMIT_RTPRIO, 1, "real-time priority", NULL},
+		{'s', RLIMIT_STACK, 1024, "stack size", "kbytes"},
+		{'t', RLIMIT_CPU, 1, "cpu time", "seconds"},
+		{'u', RLIMIT_NPROC, 1, "max user processes", NULL},
+		{'v', RLIMIT_AS, 1024, "virtual memory", "kbytes"},
+		{'x', RLIMIT_LOCKS, 1, "file locks", NULL},
+		{'\0', 0, 0, NULL, NULL}
+	};
+	int k;
+
+	for (k = 0; limits[k].opt; k++)
+		if (limits[k].opt == opt)
+			return (&limits[k]);
+	return (NULL);
+}
+
+/**
+ * ulimit_show - Writes a resource limit.
+ * @info: The parameter struct.
+ * @u: The limit.
+ * @hard: Set to write the hard limit instead of the soft one.
+ * @label: Set to write the name and unit before it, as 'ulimit -a' does.
+ *
+ * Return: 0 on success, 1 after reporting a failure.
+ */
+int ulimit_show(info_t *info, ulimit_t *u, int hard, int label)
+{
+	struct rlimit rl;
+	char unit[48], line[96];
+	rlim_t v;
+
+	rl.rlim_cur = rl.rlim_max = PIPE_BUF;
+	if (u->res != -1 && getrlimit(u->res, &rl))
+	{
+		fprintf(stderr, "%s: %d: ulimit: %s: cannot get limit: %s\n",
+				info->fname, info->line_count, u->desc, strerror(errno));
+		return (1);
+	}
+	if (label)
+	{
+		if (u->unit)
+			sprintf(unit, "(%s, -%c) ", u->unit, u->opt);
+		else
+			sprintf(unit, "(-%c) ", u->opt);
+		sprintf(line, "%-20s %20s", u->desc, unit);
+		prnt_strn(line);
+	}
+	v = hard ? rl.rlim_max : rl.rlim_cur;
+	prnt_strn(v == RLIM_INFINITY ? "unlimited" :
+			number_to_strn(v / u->factor, 10, 0));
+	prnt_strn("\n");
+	return (0);
+}
+
+/**
+ * ulimit_set - Sets a resource limit of the shell.
+ * @info: The parameter struct.
+ * @u: The limit.
+ * @value: A number in the limit's unit, 'unlimited', 'hard' or 'soft'.
+ * @how: 1 to set the soft limit, 2 the hard one, 0 or 3 both.
+ *
+ * Return: 0 on success, 1 after reporting a failure.
+ */
+int ulimit_set(info_t *info, ulimit_t *u, char *value, int how)
+{
+	struct rlimit rl;
+	unsigned long n;
+	rlim_t v;
+	char *end;
+
+	errno = EINVAL;
+	if (u->res == -1 || getrlimit(u->res, &rl))
+		return (fprintf(stderr, "%s: %d: ulimit: %s: cannot modify limit: %s\n",
+					info->fname, info->line_count, u->desc, strerror(errno)), 1);
+	if (!strcmp(value, "unlimited") || !strcmp(value, "hard") ||
+			!strcmp(value, "soft"))
+		v = *value == 'u' ? RLIM_INFINITY : *value == 'h' ? rl.rlim_max :
+			rl.rlim_cur;
+	else
+	{
+		errno = 0;
+		n = strtoul(value, &end, 10);
+		if (*value < '0' || *value > '9' || *end || errno ||
+				n > (RLIM_INFINITY - 1) / u->factor)
+			return (fprintf(stderr, "%s: %d: ulimit: %s: invalid number\n",
+						info->fname, info->line_count, value), 1);
+		v = n * u->factor;
+	}
+	if (how != 2)
+		rl.rlim_cur = v;
+	if (how != 1)
+		rl.rlim_max = v;
+	if (!setrlimit(u->res, &rl))
+		return (0);
+	fprintf(stderr, "%s: %d: ulimit: %s: cannot modify limit: %s\n",
+			info->fname, info->line_count, u->desc, strerror(errno));
+	return (1);
+}
@@ -1,92 +1,5 @@
 #include "myshell.h"
 
-/**
- * lookFor_chain - Determines whether chaining should continue.
- *
- * Checks if chaining should continue based on the last command's status
- * and updates the buffer accordingly.
- *
- * @info: The parameter struct containing command information.
- * @buff: The character buffer to update.
- * @c: Address of the current position in the buffer.
- * @d: Starting position in the buffer.
- * @leng: Length of the buffer.
- *
- * Return: Void.
- */
-void lookFor_chain(info_t *info, char *buff, size_t *c, size_t d, size_t leng)
-{
-	size_t a = *c;
-
-	switch (info->cmd_buffer_type)
-	{
-		case CMND_AND:
-			/* If the last command had a successful status, terminate the buffer. */
-			if (info->status)
-			{
-				buff[d] = 0;
-				a = leng;
-			}
-			break;
-
-		case CMND_OR:
-			/* If the last command had an unsuccessful status, terminate the buffer. */
-			if (!info->status)
-			{
-				buff[d] = 0;
-				a = leng;
-			}
-			break;
-
-		default:
-			/* Handle any other cases as needed. */
-			break;
-	}
-
-	*c = a;
-}
-
-/**
- * isChainDelimiter - Checks if the current character is a delimiter.
- *
- * This function examines the character in the buffer at the current position
- * to determine if it is a chain delimiter ('||', '&&', or ';').
- *
- * @info: The parameter struct containing command information.
- * @buff: The character buffer to analyze.
- * @currentPos: Address of the current position in the buffer.
- *
- * Return: 1 if the current character is a chain delimiter, 0 otherwise.
- */
-int isChainDelimiter(info_t *info, char *buff, size_t *currentPos)
-{
-	size_t currentChar = *currentPos;
-
-	if (buff[currentChar] == '|' && buff[currentChar + 1] == '|')
-	{
-		buff[currentChar] = 0;
-		currentChar++; /* Increment currentChar to skip the second '|'. */
-		info->cmd_buffer_type = CMND_OR;
-	}
-	else if (buff[currentChar] == '&' && buff[currentChar + 1] == '&')
-	{
-		buff[currentChar] = 0;
-		currentChar++; /* Increment currentChar to skip the second '&'. */
-		info->cmd_buffer_type = CMND_AND;
-	}
-	else if (buff[currentChar] == ';') /* Found the end of this command */
-	{
-		buff[currentChar] = 0;
-		info->cmd_buffer_type = CMND_CHAIN;
-}
-	else
-	{
-		return (0); /* No chain delimiter found. */
-	}
-*currentPos = currentChar;
-return (1); /* Chain delimiter found and processed. */
-}
-
 /**
  * sub_strn - Replaces a string with a new one.
  *
@@ -113,7 +26,8 @@ int sub_strn(char **former, char *new)
  * replaceAlias - Replaces an alias in the tokenized string.
  *
  * This function searches for and replaces an alias in the command's arguments
- * based on the parameter struct information.
+ * based on the parameter struct information. The alias value is split
+ * into words, so "alias ll='ls -l'" runs ls with the -l option.
  *
  * @info: The parameter struct containing command information.
  *
@@ -123,35 +37,40 @@ int replaceAlias(info_t *info)
 {
 	int aliasSearchLimit = 0; /* Limit d number of alias replacement attempts. */
 	list_t *aliasNode;
-	char *aliasValue;
+	char *aliasValue, **words, **argv;
+	int a, n;
 
 	while (aliasSearchLimit < 10) /* Loop up to 10 times */
 	{
 		/* Find any alias stored */
 		aliasNode = find_node(info->alias, info->argv[0], '=');
 		if (aliasNode == NULL) /* If no alias is found */
+			return (aliasSearchLimit > 0);
+		aliasValue = str_chr(aliasNode->str, '=');
+		words = aliasValue ? lex_words(aliasValue + 1) : NULL;
+		for (n = 0; words && words[n]; n++)
+			;
+		argv = n ? malloc(sizeof(char *) * (n + info->argc)) : NULL;
+		if (!argv) /* An empty alias or no memory: leave the command */
 		{
-			/* Return 0 to indicate failure */
+			free_strn(words);
 			return (0);
 		}
-		else
-		{
-			free(info->argv[0]); /* Free the memory of the old alias */
-			/* Find the character '=' in the alias */
-			aliasValue = str_chr(aliasNode->str, '=');
-			if (!aliasValue) /* If '=' is not found */
-			{
-				return (0);
-			}
-			aliasValue = dupStrn(aliasValue + 1); /* Duplicate the content after '=' */
-			if (!aliasValue) /* If duplication fails */
-			{
-				return (0);
-			}
-			/* Update argv[0] with the new alias content */
-			info->argv[0] = aliasValue;
-			aliasSearchLimit++; /* Increment the counter */
-		}
+		/* Splice the alias words in place of the old command name */
+		for (a = 0; a < n; a++)
+			argv[a] = words[a];
+		for (a = 1; a <= info->argc; a++)
+			argv[n + a - 1] = info->argv[a];
+		free(info->argv[0]);
+		free(info->argv);
+		free(words);
+		info->argv = argv;
+		info->argc += n - 1;
+		aliasSearchLimit++; /* Increment the counter */
+		/* An alias naming itself (alias ls='ls -F') is not expanded again */
+		n = aliasValue - aliasNode->str;
+		if (!strncmp(argv[0], aliasNode->str, n) && !argv[0][n])
+			return (1);
 	}
 
 	return (1);
@@ -160,48 +79,20 @@ int replaceAlias(info_t *info)
 /**
  * replaceVariables - Replaces variables in the tokenized string.
  *
- * This function searches for and replaces variables in the command's arguments
- * based on the parameter struct information.
+ * This function expands every parameter reference ($NAME, ${NAME}, array
+ * forms such as ${a[i]} and ${a[@]}, $?, $$ and the positional parameters)
+ * found anywhere inside the command's arguments and its prefix assignments,
+ * looking names up in the shell's symbol table, and removes quotes.
+ * 'argc' is updated to the expanded word count.
  *
  * @info: The parameter struct containing command information.
  *
- * Return: 1 if variables are replaced, 0 otherwise.
+ * Return: Always 1.
  */
 int replaceVariables(info_t *info)
 {
-	list_t *node;/* Pointer to a linked list node */
-	int argumentIndex = 0;/* Index for iterating through command arguments. */
-
-	for (argumentIndex = 0; info->argv[argumentIndex]; argumentIndex++)
-	{
-		if (info->argv[argumentIndex][0] != '$' || !info->argv[argumentIndex][1])
-		{
-			continue; /* Skip non-variable arguments */
-		}
-
-		if (!strcmp(info->argv[argumentIndex], "$?")) /* If the argument is "$?" */
-		{
-			sub_strn(&(info->argv[argumentIndex]),
-					strdup(number_to_strn(info->status, 10, 0)));
-			continue;
-		}
-
-		if (!strcmp(info->argv[argumentIndex], "$$")) /* If the argument is "$$" */
-		{
-			sub_strn(&(info->argv[argumentIndex]),
-					strdup(number_to_strn(getpid(), 10, 0)));
-			continue;
-		}
-
-		node = find_node(info->env, &info->argv[argumentIndex][1], '=');
-		if (node) /* If the environment variable is found */
-		{
-			sub_strn(&(info->argv[argumentIndex]), strdup(str_chr(node->str, '=') + 1));
-			continue;
-		}
-
-		sub_strn(&info->argv[argumentIndex], strdup(""));
-	}
-
-	return (0);
+	/* Assignments stay one word; ${a[@]} may turn one argument into many */
+	expand_vector(info, &info->assignv, 0);
+	info->argc = expand_vector(info, &info->argv, 1);
+	return (1);
 }
@@ -0,0 +1,182 @@
+#include "myshell.h"
+
+/**
+ * vm_run - Runs a compiled program.
+ * @info: The parameter struct.
+ * @prog: The program; it stays referenced while it runs, so a function
+ *        may redefine itself.
+ *
+ * The program stops early once 'return' or 'exit' has set info->unwind;
+ * 'break' and 'continue' jump within it, undoing the redirections of the
+ * compound commands they leave.
+ *
+ * Return: The status of the last command run.
+ */
+int vm_run(info_t *info, prog_t *prog)
+{
+	loop_t *loops = NULL;
+	redirframe_t *frames = NULL;
+	char *subject = NULL;
+	instr_t *in;
+	int pc = 0, depth = 0;
+
+	if (prog->loops && !(loops = malloc(sizeof(loop_t) * prog->loops)))
+		return (info->status = 1);
+	prog->refs++;
+	while (prog->code[pc].op != OP_END)
+	{
+		in = &prog->code[pc++];
+		if (in->op == OP_CMD)
+		{
+			vm_simple(info, &prog->cmds[in->a]);
+			if (!info->unwind)
+				continue;
+			if (vm_unwind(info, loops, &depth, &pc))
+				pc = prog->len - 1; /* the OP_END */
+			while (frames && frames->depth >= depth)
+				vm_unredir(info, &frames);
+		}
+		else if (in->op == OP_JMP || (in->op == OP_JZ && !info->status) ||
+				(in->op == OP_JNZ && info->status))
+			pc = in->a;
+		else if (in->op == OP_NOT || in->op == OP_TRUE)
+			info->status = in->op == OP_NOT ? !info->status : 0;
+		else if (in->op == OP_DEFUN)
+			info->status = func_define(info, prog->cmds[in->a].words[0],
+					prog->cmds[in->a].sub) ? 1 : 0;
+		else if (in->op == OP_CASE)
+		{
+			free(subject);
+			subject = expand_string(info, prog->cmds[in->a].words[0],
+					strlen(prog->cmds[in->a].words[0]));
+		}
+		else if (in->op == OP_MATCH)
+			pc = case_match(info, subject, prog->cmds[in->a].words) ? pc : in->b;
+		else if (in->op >= OP_REDIR)
+			pc = vm_group(info, prog, pc - 1, &frames, depth);
+		else if (in->op != OP_JZ && in->op != OP_JNZ)
+			pc = vm_loop(info, prog, pc - 1, loops, &depth);
+	}
+	while (frames)
+		vm_unredir(info, &frames);
+	while (depth)
+		vm_pop(info, loops, &depth);
+	free(loops);
+	free(subject);
+	prog_free(prog);
+	return (info->status);
+}
+
+/**
+ * vm_simple - Expands and runs one simple command.
+ * @info: The parameter struct.
+ * @cmd: The command; its words are copied, never modified.
+ */
+void vm_simple(info_t *info, cmd_t *cmd)
+{
+	int saved[REDIR_FDS], redirected = 0;
+
+	info->line_count = cmd->line;
+	infoSet(info, cmd->words);
+	if (info->argv && cmd->redirs)
+		redirected = !redir_apply(info, cmd->redirs, saved);
+	if (!info->argv || (cmd->redirs && !redirected))
+		info->status = 1;
+	else if (!info->argc)/* Assignments only, or nothing left */
+		info->status = info->assigns ? run_assignments(info) : info->status;
+	else /* the builtin found when compiling, unless an alias changed argv */
+		exec_command(info, cmd->name && !strcmp(info->argv[0], cmd->name) ?
+				cmd->builtin : NULL);
+	if (redirected)
+		redir_done(info, saved);
+	procsub_reap(info);
+	infoFree(info, 0);
+	infoClear(info);
+}
+
+/**
+ * vm_loop - Runs one of the loop instructions.
+ * @info: The parameter struct.
+ * @prog: The running program.
+ * @pc: The index of the instruction.
+ * @loops: The stack of running loops.
+ * @depth: The number of entries on @loops.
+ *
+ * Return: The index of the next instruction to run.
+ */
+int vm_loop(info_t *info, prog_t *prog, int pc, loop_t *loops, int *depth)
+{
+	instr_t *in = &prog->code[pc];
+	loop_t *top = *depth ? &loops[*depth - 1] : NULL;
+	char **words = in->op == OP_FOR || in->op == OP_NEXT ?
+		prog->cmds[in->a].words : NULL;
+
+	if (in->op == OP_LOOP)
+	{
+		top = &loops[(*depth)++];
+		memset(top, 0, sizeof(loop_t));
+		top->brk = in->a;
+		top->cont = in->b;
+		info->loops++;
+	}
+	else if (in->op == OP_FOR)
+		vm_for(info, top, words);
+	else if (in->op == OP_NEXT && !vm_next(info, top, words[0]))
+		return (in->b);
+	else if (in->op == OP_AGAIN)
+	{
+		top->status = info->status;
+		return (in->a);
+	}
+	else if (in->op == OP_POPLOOP)
+	{
+		info->status = top->status;
+		vm_pop(info, loops, depth);
+	}
+	return (pc + 1);
+}
+
+/**
+ * vm_unwind - Handles a 'break' or 'continue' after a command.
+ * @info: The parameter struct; info->levels tells how many loops to leave.
+ * @loops: The stack of running loops.
+ * @depth: The number of entries on @loops.
+ * @pc: Receives where the program goes on.
+ *
+ * Return: 1 if the program must stop ('return' or 'exit'), 0 otherwise.
+ */
+int vm_unwind(info_t *info, loop_t *loops, int *depth, int *pc)
+{
+	if ((info->unwind & ~(UNWIND_BREAK | UNWIND_CONTINUE)) || !*depth)
+		return (1);
+	for (; *depth > 1 && info->levels > 1; info->levels--)
+		vm_pop(info, loops, depth);
+	if (info->unwind & UNWIND_BREAK)
+	{
+		loops[*depth - 1].status = info->status;
+		*pc = loops[*depth - 1].brk;
+	}
+	else
+		*pc = loops[*depth - 1].cont;
+	info->unwind = 0;
+	info->levels = 0;
+	return (0);
+}
+
+/**
+ * vm_pop - Removes the innermost running loop.
+ * @info: The parameter struct.
+ * @loops: The stack of running loops.
+ * @depth: The number of entries on @loops.
+ */
+void vm_pop(info_t *info, loop_t *loops, int *depth)
+{
+	loop_t *top = &loops[--*depth];
+	size_t a;
+
+	free_strn(top->vals);
+	for (a = 0; a < top->ngens; a++)
+		brace_free(top->gens[a]);
+	free(top->gens);
+	info->loops--;
+}
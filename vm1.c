@@ -0,0 +1,76 @@
+#include "myshell.h"
+
+/**
+ * vm_for - Expands the word list of a for loop.
+ * @info: The parameter struct.
+ * @top: The loop.
+ * @words: The loop's variable name followed by its raw words.
+ *
+ * Words that are only brace expansions keep their generator instead of
+ * their words, so {1..1000000} costs the same memory as {1..2}.
+ */
+void vm_for(info_t *info, loop_t *top, char **words)
+{
+	wordlist_t wl = {NULL, 0, 0, 0};
+	brace_t *b, **gens;
+	size_t a, cap;
+
+	for (a = 1; words[a]; a++)
+	{
+		b = brace_lazy(words[a]);
+		if (b && wl.n >= top->ngens)
+		{
+			cap = wl.n * 2 + 8;
+			gens = realloc(top->gens, sizeof(brace_t *) * cap);
+			if (gens)
+			{
+				memset(gens + top->ngens, 0,
+						sizeof(brace_t *) * (cap - top->ngens));
+				top->gens = gens;
+				top->ngens = cap;
+			}
+		}
+		if (b && wl.n < top->ngens && !wl_push(&wl, dupStrn(words[a])))
+			top->gens[wl.n - 1] = b;
+		else
+			brace_free(b), glob_fields(info, words[a], &wl);
+	}
+	top->vals = wl.v;
+	top->n = wl.n;
+}
+
+/**
+ * vm_next - Sets the variable of a for loop to its next value.
+ * @info: The parameter struct.
+ * @top: The loop.
+ * @name: The name of the variable.
+ *
+ * Return: 1 if the loop runs again, 0 once the values are used up.
+ */
+int vm_next(info_t *info, loop_t *top, char *name)
+{
+	strbuf_t sb = {NULL, 0, 0};
+	brace_t *b;
+
+	while (top->i < top->n)
+	{
+		b = top->i < top->ngens ? top->gens[top->i] : NULL;
+		if (!b)
+			return (var_set(info, name, strlen(name), top->vals[top->i++], 0), 1);
+		if (top->gi >= brace_total(b))
+		{
+			top->i++, top->gi = 0;
+			continue;
+		}
+		sb.len = 0;
+		brace_nth(b, top->gi++, &sb);
+		if (sb.len) /* an empty word is no value */
+		{
+			var_set(info, name, strlen(name), sb.s, 0);
+			free(sb.s);
+			return (1);
+		}
+	}
+	free(sb.s);
+	return (0);
+}
@@ -0,0 +1,124 @@
+#include "myshell.h"
+
+/**
+ * vm_group - Runs an OP_REDIR, OP_UNREDIR, OP_SUBSHELL, OP_PIPE or
+ *            OP_COND instruction.
+ * @info: The parameter struct.
+ * @prog: The running program.
+ * @pc: The index of the instruction.
+ * @frames: The redirections of the compound commands running.
+ * @depth: The number of loops running.
+ *
+ * Return: The index of the next instruction to run.
+ */
+int vm_group(info_t *info, prog_t *prog, int pc, redirframe_t **frames,
+		int depth)
+{
+	instr_t *in = &prog->code[pc];
+	redirframe_t *f;
+
+	if (in->op == OP_PIPE)
+		vm_pipe(info, &prog->cmds[in->a], in->b);
+	else if (in->op == OP_COND)
+		cond_run(info, &prog->cmds[in->a]);
+	else if (in->op == OP_SUBSHELL)
+		vm_subshell(info, &prog->cmds[in->a]);
+	else if (in->op == OP_UNREDIR)
+		vm_unredir(info, frames);
+	else
+	{
+		info->line_count = prog->cmds[in->a].line;
+		f = malloc(sizeof(redirframe_t));
+		if (!f || redir_apply(info, prog->cmds[in->a].redirs, f->saved))
+		{
+			free(f);
+			procsub_reap(info);
+			info->status = 1;
+			return (in->b);
+		}
+		f->procsubs = info->procsubs; /* reaped once the command is done */
+		info->procsubs = NULL;
+		f->depth = depth;
+		f->next = *frames;
+		*frames = f;
+	}
+	return (pc + 1);
+}
+
+/**
+ * vm_unredir - Undoes the redirections of the innermost compound command.
+ * @info: The parameter struct.
+ * @frames: The redirections of the compound commands running.
+ *
+ * The command's status is kept.
+ */
+void vm_unredir(info_t *info, redirframe_t **frames)
+{
+	redirframe_t *f = *frames;
+	procsub_t *ps = info->procsubs;
+
+	if (!f)
+		return;
+	*frames = f->next;
+	redir_restore(f->saved);
+	info->procsubs = f->procsubs;
+	procsub_reap(info);
+	info->procsubs = ps;
+	free(f);
+}
+
+/**
+ * vm_subshell - Runs a ( list ) subshell in a child process.
+ * @info: The parameter struct.
+ * @cmd: The command holding the compiled list and its redirections.
+ *
+ * The child makes the redirections without saving anything, since it
+ * never needs them undone, and nothing it changes reaches the shell.
+ */
+void vm_subshell(info_t *info, cmd_t *cmd)
+{
+	int saved[REDIR_FDS], status;
+	pid_t pid;
+
+	info->line_count = cmd->line;
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	pid = fork();
+	if (pid == -1)
+	{
+		perror("Error:");
+		info->status = 1;
+		return;
+	}
+	if (!pid)
+	{
+		if (cmd->redirs && redir_apply(info, cmd->redirs, saved))
+			info->status = 1;
+		else
+			vm_run(info, cmd->sub);
+		subshell_exit(info);
+	}
+	if (waitpid(pid, &status, 0) == -1)
+		info->status = 1;
+	else
+		info->status = WIFEXITED(status) ? WEXITSTATUS(status) :
+			128 + WTERMSIG(status);
+}
+
+/**
+ * subshell_exit - Ends a child running part of the script.
+ * @info: The parameter struct.
+ *
+ * Buffered output is written and the child's own process substitutions
+ * are waited for. The exit status is the one given to 'exit', if it ran,
+ * and otherwise the status of the last command.
+ */
+void subshell_exit(info_t *info)
+{
+	wrt_chr(BUFFER_FLUSH);
+	fflush(stdout);
+	procsub_reap(info);
+	if (info->unwind & UNWIND_EXIT && info->err_number != -1)
+		exit(info->err_number);
+	exit(info->status);
+}
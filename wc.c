@@ -0,0 +1,162 @@
+#include "myshell.h"
+
+/**
+ * wc_cmd - Counts the lines, words and bytes of files.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ *
+ * Usage: wc [-lwc] [file...]
+ * With no file, or for a '-', the standard input is read. The counts are
+ * laid out as coreutils does; other options hand the command over to the
+ * wc program.
+ *
+ * Return: 0 on success, 1 if a file could not be read, or -1 to run the
+ *         wc program instead.
+ */
+int wc_cmd(info_t *info)
+{
+	filter_t f;
+	long counts[3], total[3] = {0, 0, 0};
+	int a, k, b, want = 0, width;
+	char *o;
+
+	for (a = 1; a < info->argc && info->argv[a][0] == '-' &&
+			info->argv[a][1]; a++)
+	{
+		if (!strcmp(info->argv[a], "--") && ++a)
+			break;
+		for (o = info->argv[a] + 1; *o; o++)
+			if (!str_chr("lwc", *o))
+				return (-1);
+			else
+				want |= *o == 'l' ? 1 : *o == 'w' ? 2 : 4;
+	}
+	want = want ? want : 7;
+	width = wc_width(info, a, want);
+	filter_init(info, &f);
+	for (k = a; k == a || k < info->argc; k++)
+	{
+		if (filter_open(&f, k < info->argc ? info->argv[k] : "-"))
+			continue;
+		wc_file(&f, counts, want);
+		filter_close(&f);
+		for (b = 0; b < 3; b++)
+			total[b] += counts[b];
+		wc_print(&f, counts, want, width, k < info->argc ? f.name : NULL);
+	}
+	if (info->argc - a > 1)
+		wc_print(&f, total, want, width, "total");
+	return (filter_end(&f, f.failed));
+}
+
+/**
+ * wc_file - Counts the input of a wc command.
+ * @f: The filter reading the input.
+ * @counts: Receives the lines, words and bytes.
+ * @want: The counts wanted, bit 0 for lines, 1 for words and 2 for bytes.
+ *
+ * Lines are counted with memchr() a block at a time; a word is a run of
+ * bytes between white space with a printable byte in it. The bytes alone
+ * of a regular file are its size, found without reading it.
+ */
+void wc_file(filter_t *f, long *counts, int want)
+{
+	struct stat st;
+	off_t cur;
+	unsigned char *p, *end;
+	int word = 0;
+
+	counts[0] = counts[1] = counts[2] = 0;
+	if (want == 4 && !fstat(f->fd, &st) && S_ISREG(st.st_mode) &&
+			st.st_size && (cur = lseek(f->fd, 0, SEEK_CUR)) != -1)
+	{
+		counts[2] = st.st_size > cur ? st.st_size - cur : 0;
+		lseek(f->fd, 0, SEEK_END);
+		return;
+	}
+	while (filter_fill(f) > 0)
+	{
+		counts[2] += f->in.len;
+		if (want & 1)
+			counts[0] += filter_lines(f->in.s, f->in.len);
+		p = (unsigned char *)f->in.s;
+		for (end = p + f->in.len; want & 2 && p < end; p++)
+			if (*p == ' ' || (*p >= '\t' && *p <= '\r'))
+				word = 0;
+			else if (!word && *p > ' ' && *p < 127)
+				word = 1, counts[1]++;
+		f->pos = f->in.len;
+	}
+}
+
+/**
+ * wc_width - Chooses the width of the counts of a wc command.
+ * @info: The parameter struct holding the builtin's 'argv'.
+ * @a: The index of the first file.
+ * @want: The counts wanted.
+ *
+ * As with coreutils, a single count of a single file is not padded;
+ * otherwise the counts are as wide as the total size of the regular
+ * files, and at least 7 if any input is not a regular file. A file
+ * with no links is taken for a pipe, as it is the memfd_create() file
+ * pipe_local() passes from one stage run in the shell to the next.
+ *
+ * Return: The width.
+ */
+int wc_width(info_t *info, int a, int want)
+{
+	struct stat st;
+	off_t total = 0;
+	int k, width = 1, min = 1;
+
+	if (info->argc - a <= 1 && (want == 1 || want == 2 || want == 4))
+		return (1);
+	for (k = a; k == a || k < info->argc; k++)
+	{
+		if (k < info->argc && strcmp(info->argv[k], "-") ?
+				stat(info->argv[k], &st) : fstat(STDIN_FILENO, &st))
+		{
+			if (k == a)
+				return (1);
+			continue;
+		}
+		if (S_ISREG(st.st_mode) && st.st_nlink)
+			total += st.st_size;
+		else
+			min = 7;
+	}
+	for (; total >= 10; total /= 10)
+		width++;
+	return (width < min ? min : width);
+}
+
+/**
+ * wc_print - Writes the counts of one input of a wc command.
+ * @f: The filter.
+ * @counts: The lines, words and bytes.
+ * @want: The counts wanted.
+ * @width: The width of each count.
+ * @name: The name written after the counts, NULL for none.
+ */
+void wc_print(filter_t *f, long *counts, int want, int width, char *name)
+{
+	char *s;
+	int b, pad, first = 1;
+
+	for (b = 0; b < 3; b++)
+		if (want & 1 << b)
+		{
+			s = number_to_strn(counts[b], 10, 0);
+			if (!first)
+				filter_put(f, " ", 1);
+			for (pad = width - strlen(s); pad > 0; pad--)
+				filter_put(f, " ", 1);
+			filter_put(f, s, strlen(s));
+			first = 0;
+		}
+	if (name)
+	{
+		filter_put(f, " ", 1);
+		filter_put(f, name, strlen(name));
+	}
+	filter_put(f, "\n", 1);
+}